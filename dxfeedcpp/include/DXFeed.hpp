@@ -16,10 +16,14 @@
 #include "events/Configuration.hpp"
 #include "events/Direction.hpp"
 #include "events/Event.hpp"
+#include "events/EventFields.hpp"
 #include "events/EventFlags.hpp"
+#include "events/EventRegistry.hpp"
+#include "events/EventSerializers.hpp"
 #include "events/EventSource.hpp"
 #include "events/EventTraits.hpp"
 #include "events/EventType.hpp"
+#include "events/EventView.hpp"
 #include "events/Greeks.hpp"
 #include "events/Order.hpp"
 #include "events/OrderScope.hpp"
@@ -33,15 +37,25 @@
 #include "events/Trade.hpp"
 #include "events/Underlying.hpp"
 
+#include "helpers/Dispatcher.hpp"
 #include "helpers/Handler.hpp"
 #include "helpers/IdGenerator.hpp"
+#include "helpers/InplaceFunction.hpp"
+#include "helpers/IntrusivePtr.hpp"
+#include "helpers/ListenerStats.hpp"
 #include "helpers/LogDumper.hpp"
+#include "helpers/MPSCQueue.hpp"
+#include "helpers/ObjectPool.hpp"
+#include "helpers/RcuPointer.hpp"
+#include "helpers/SymbolTable.hpp"
+#include "helpers/ThreadingConfig.hpp"
 
 #include "processors/AbstractEventCheckingProcessor.hpp"
 #include "processors/AbstractEventProcessor.hpp"
 #include "processors/CompositeProcessor.hpp"
 
 #include "subscriptions/Subscription.hpp"
+#include "subscriptions/TypedSubscription.hpp"
 
 #include <memory>
 #include <string>
@@ -59,24 +73,65 @@ namespace DXFeed {
  * @param address The address to connect
  * @param onDisconnectListener The onDisconnect listener
  * @param onConnectionStatusChangedListener The onConnectionStatusChanged listener
+ * @param dispatcher The dispatcher whose workers will notify the listeners of the connection and its subscriptions
  * @return A shared pointer to the new connection object or Connection::INVALID
  */
 template <typename OnDisconnectListener = typename Handler<void()>::ListenerType,
           typename OnConnectionStatusChangedListener =
               typename Handler<void(ConnectionStatus, ConnectionStatus)>::ListenerType>
 inline Connection::Ptr connect(const std::string &address, OnDisconnectListener &&onDisconnectListener,
-                               OnConnectionStatusChangedListener &&onConnectionStatusChangedListener) {
+                               OnConnectionStatusChangedListener &&onConnectionStatusChangedListener,
+                               Dispatcher::Ptr dispatcher = Dispatcher::getDefault()) {
     return Connection::create(address, std::forward<OnDisconnectListener>(onDisconnectListener),
-                              std::forward<OnConnectionStatusChangedListener>(onConnectionStatusChangedListener));
+                              std::forward<OnConnectionStatusChangedListener>(onConnectionStatusChangedListener),
+                              std::move(dispatcher));
 }
 
 /**
  * Creates the new connection to specified address
  *
  * @param address The address to connect
+ * @param dispatcher The dispatcher whose workers will notify the listeners of the connection and its subscriptions
  * @return A shared pointer to the new connection object or Connection::INVALID
  */
-inline Connection::Ptr connect(const std::string &address) { return Connection::create(address); }
+inline Connection::Ptr connect(const std::string &address, Dispatcher::Ptr dispatcher = Dispatcher::getDefault()) {
+    return Connection::create(address, std::move(dispatcher));
+}
+
+/**
+ * Creates the new connection to specified address with specified onDisconnect & onConnectionStatusChanged listeners.
+ * The listeners of the connection and its subscriptions are notified by the new threads configured by threadingConfig.
+ *
+ * @tparam OnDisconnectListener The type of a onDisconnect listener (it could be any callable)
+ * @tparam OnConnectionStatusChangedListener The type of onConnectionStatusChanged listener
+ * @param address The address to connect
+ * @param onDisconnectListener The onDisconnect listener
+ * @param onConnectionStatusChangedListener The onConnectionStatusChanged listener
+ * @param threadingConfig The configuration of the threads (the number of threads, CPU affinity, names, scheduling)
+ * @return A shared pointer to the new connection object or Connection::INVALID
+ */
+template <typename OnDisconnectListener = typename Handler<void()>::ListenerType,
+          typename OnConnectionStatusChangedListener =
+              typename Handler<void(ConnectionStatus, ConnectionStatus)>::ListenerType>
+inline Connection::Ptr connect(const std::string &address, OnDisconnectListener &&onDisconnectListener,
+                               OnConnectionStatusChangedListener &&onConnectionStatusChangedListener,
+                               const ThreadingConfig &threadingConfig) {
+    return Connection::create(address, std::forward<OnDisconnectListener>(onDisconnectListener),
+                              std::forward<OnConnectionStatusChangedListener>(onConnectionStatusChangedListener),
+                              threadingConfig);
+}
+
+/**
+ * Creates the new connection to specified address. The listeners of the connection and its subscriptions are notified
+ * by the new threads configured by threadingConfig.
+ *
+ * @param address The address to connect
+ * @param threadingConfig The configuration of the threads (the number of threads, CPU affinity, names, scheduling)
+ * @return A shared pointer to the new connection object or Connection::INVALID
+ */
+inline Connection::Ptr connect(const std::string &address, const ThreadingConfig &threadingConfig) {
+    return Connection::create(address, threadingConfig);
+}
 } // namespace DXFeed
 
 } // namespace dxfcpp
\ No newline at end of file
@@ -26,4 +26,12 @@
 #        define DXFCPP_CONSTEXPR
 #        define DXFCPP_USE_CONSTEXPR const
 #    endif
-#endif
\ No newline at end of file
+#endif
+
+#ifndef DXFCPP_USE_SSE2
+#    if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define DXFCPP_USE_SSE2 1
+#    else
+#        define DXFCPP_USE_SSE2 0
+#    endif
+#endif
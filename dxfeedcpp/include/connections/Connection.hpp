@@ -11,17 +11,21 @@ extern "C" {
 }
 
 #include <functional>
+#include <future>
 #include <mutex>
 #include <string>
 #include <utility>
 
 #include "common/DXFCppConfig.hpp"
 
+#include "helpers/Dispatcher.hpp"
+#include "helpers/ThreadingConfig.hpp"
 #include "helpers/Handler.hpp"
 
 #include "ConnectionStatus.hpp"
 
 #include "subscriptions/Subscription.hpp"
+#include "subscriptions/TypedSubscription.hpp"
 
 namespace dxfcpp {
 
@@ -51,16 +55,19 @@ struct Connection final : public std::enable_shared_from_this<Connection> {
     mutable std::recursive_mutex mutex_{};
     dxf_connection_t connectionHandle_ = nullptr;
 
-    Handler<void()> onDisconnect_{1};
-    Handler<void(ConnectionStatus, ConnectionStatus)> onConnectionStatusChanged_{1};
-    Handler<void()> onClose_{1};
+    const Dispatcher::Ptr dispatcher_;
+
+    Handler<void()> onDisconnect_;
+    Handler<void(ConnectionStatus, ConnectionStatus)> onConnectionStatusChanged_;
+    Handler<void()> onClose_;
 
     std::vector<Subscription::WeakPtr> subscriptions_{};
     std::vector<TimeSeriesSubscription::WeakPtr> timeSeriesSubscriptions_{};
+    std::vector<std::weak_ptr<BasicSubscriptionImpl>> typedSubscriptions_{};
 
     template <typename F = std::function<void(Ptr &)>>
-    static Ptr createImpl(const std::string &address, F &&beforeConnect) {
-        auto c = std::make_shared<Connection>();
+    static Ptr createImpl(const std::string &address, Dispatcher::Ptr dispatcher, F &&beforeConnect) {
+        auto c = std::make_shared<Connection>(std::move(dispatcher));
 
         beforeConnect(c);
 
@@ -102,12 +109,34 @@ struct Connection final : public std::enable_shared_from_this<Connection> {
                 }
             }
 
+            for (const auto &sub : typedSubscriptions_) {
+                if (auto s = sub.lock()) {
+                    s->close();
+                }
+            }
+
             dxf_close_connection(connectionHandle_);
             connectionHandle_ = nullptr;
         }
     }
 
   public:
+    /**
+     * Creates the new connection wrapper without a connection handle. Use Connection::create to connect.
+     *
+     * @param dispatcher The dispatcher whose workers will notify the listeners of the connection and its subscriptions
+     */
+    explicit Connection(Dispatcher::Ptr dispatcher = Dispatcher::getDefault())
+        : dispatcher_{std::move(dispatcher)}, onDisconnect_{Handler<void()>::DEFAULT_QUEUE_SIZE, dispatcher_},
+          onConnectionStatusChanged_{Handler<void(ConnectionStatus, ConnectionStatus)>::DEFAULT_QUEUE_SIZE,
+                                     dispatcher_},
+          onClose_{Handler<void()>::DEFAULT_QUEUE_SIZE, dispatcher_} {
+        // The control notifications must not wait for the market data backlog.
+        onDisconnect_.setPriority(Dispatcher::HIGHEST_PRIORITY);
+        onConnectionStatusChanged_.setPriority(Dispatcher::HIGHEST_PRIORITY);
+        onClose_.setPriority(Dispatcher::HIGHEST_PRIORITY);
+    }
+
     Connection &operator=(Connection &) = delete;
 
     /// Tries to "send" the onClose notification (used by TimeSeriesFuture) and tries to close all subscriptions
@@ -127,8 +156,11 @@ struct Connection final : public std::enable_shared_from_this<Connection> {
         return ConnectionStatus::NOT_CONNECTED;
     }
 
+    /// Returns the dispatcher whose workers notify the listeners of the connection and its subscriptions
+    const Dispatcher::Ptr &getDispatcher() const { return dispatcher_; }
+
     /// Returns the onDisconnect handler that notifies all listeners asynchronously that the connection has been
-    /// disconnected.
+    /// disconnected. The connection's handlers use the highest priority level of the dispatcher.
     Handler<void()> &onDisconnect() { return onDisconnect_; }
 
     /// Returns the onConnectionStatusChanged handler that notifies all listeners asynchronously that the connection
@@ -148,28 +180,67 @@ struct Connection final : public std::enable_shared_from_this<Connection> {
      * @param address The address to connect
      * @param onDisconnectListener The onDisconnect listener
      * @param onConnectionStatusChangedListener The onConnectionStatusChanged listener
+     * @param dispatcher The dispatcher whose workers will notify the listeners of the connection and its subscriptions
      * @return A shared pointer to the new connection object or Connection::INVALID
      */
     template <typename OnDisconnectListener = typename Handler<void()>::ListenerType,
               typename OnConnectionStatusChangedListener =
-                  typename Handler<void(const ConnectionStatus &, const ConnectionStatus &)>::ListenerType>
+                  typename Handler<void(ConnectionStatus, ConnectionStatus)>::ListenerType>
     static Ptr create(const std::string &address, OnDisconnectListener &&onDisconnectListener,
-                      OnConnectionStatusChangedListener &&onConnectionStatusChangedListener) {
-        return createImpl(address, [&onDisconnectListener, &onConnectionStatusChangedListener](Ptr &c) {
-            c->onDisconnect() += std::forward<OnDisconnectListener>(onDisconnectListener);
-            c->onConnectionStatusChanged() +=
-                std::forward<OnConnectionStatusChangedListener>(onConnectionStatusChangedListener);
-        });
+                      OnConnectionStatusChangedListener &&onConnectionStatusChangedListener,
+                      Dispatcher::Ptr dispatcher = Dispatcher::getDefault()) {
+        return createImpl(address, std::move(dispatcher),
+                          [&onDisconnectListener, &onConnectionStatusChangedListener](Ptr &c) {
+                              c->onDisconnect() += std::forward<OnDisconnectListener>(onDisconnectListener);
+                              c->onConnectionStatusChanged() +=
+                                  std::forward<OnConnectionStatusChangedListener>(onConnectionStatusChangedListener);
+                          });
     }
 
     /**
      * Creates the new connection to specified address
      *
      * @param address The address to connect
+     * @param dispatcher The dispatcher whose workers will notify the listeners of the connection and its subscriptions
+     * @return A shared pointer to the new connection object or Connection::INVALID
+     */
+    static Ptr create(const std::string &address, Dispatcher::Ptr dispatcher = Dispatcher::getDefault()) {
+        return createImpl(address, std::move(dispatcher), [](Ptr &) {});
+    }
+
+    /**
+     * Creates the new connection to specified address with specified onDisconnect & onConnectionStatusChanged listeners
+     * and a new dispatcher with the specified configuration of its threads
+     *
+     * @tparam OnDisconnectListener The type of a onDisconnect listener (it could be any callable)
+     * @tparam OnConnectionStatusChangedListener The type of onConnectionStatusChanged listener
+     * @param address The address to connect
+     * @param onDisconnectListener The onDisconnect listener
+     * @param onConnectionStatusChangedListener The onConnectionStatusChanged listener
+     * @param threadingConfig The configuration of the threads of the connection (CPU affinity, names, scheduling)
+     * @return A shared pointer to the new connection object or Connection::INVALID
+     */
+    template <typename OnDisconnectListener = typename Handler<void()>::ListenerType,
+              typename OnConnectionStatusChangedListener =
+                  typename Handler<void(ConnectionStatus, ConnectionStatus)>::ListenerType>
+    static Ptr create(const std::string &address, OnDisconnectListener &&onDisconnectListener,
+                      OnConnectionStatusChangedListener &&onConnectionStatusChangedListener,
+                      const ThreadingConfig &threadingConfig) {
+        return create(address, std::forward<OnDisconnectListener>(onDisconnectListener),
+                      std::forward<OnConnectionStatusChangedListener>(onConnectionStatusChangedListener),
+                      std::make_shared<Dispatcher>(threadingConfig));
+    }
+
+    /**
+     * Creates the new connection to specified address and a new dispatcher with the specified configuration of its
+     * threads
+     *
+     * @param address The address to connect
+     * @param threadingConfig The configuration of the threads of the connection (CPU affinity, names, scheduling)
      * @return A shared pointer to the new connection object or Connection::INVALID
      */
-    static Ptr create(const std::string &address) {
-        return createImpl(address, [](Ptr &) {});
+    static Ptr create(const std::string &address, const ThreadingConfig &threadingConfig) {
+        return create(address, std::make_shared<Dispatcher>(threadingConfig));
     }
 
     /**
@@ -177,16 +248,18 @@ struct Connection final : public std::enable_shared_from_this<Connection> {
      * inferred by event type in the mask.
      *
      * @param eventTypesMask The event types mask
+     * @param shardsCount The number of delivery shards. Events are assigned to the shards by symbol, so events of one
+     * symbol are delivered in order, while events of different symbols can be delivered in parallel.
      * @return A shared pointer to the new Subscription object or Subscription::INVALID
      */
-    Subscription::Ptr createSubscription(const EventTypesMask &eventTypesMask) {
+    Subscription::Ptr createSubscription(const EventTypesMask &eventTypesMask, std::size_t shardsCount = 1) {
         std::lock_guard<std::recursive_mutex> lock{mutex_};
 
         if (connectionHandle_ == nullptr) {
             return Subscription::INVALID;
         }
 
-        auto sub = Subscription::create(connectionHandle_, eventTypesMask);
+        auto sub = Subscription::create(connectionHandle_, eventTypesMask, dispatcher_, shardsCount);
 
         if (sub) {
             subscriptions_.push_back(sub);
@@ -202,10 +275,12 @@ struct Connection final : public std::enable_shared_from_this<Connection> {
      * @tparam EventTypeIt The iterator type of the container with event types
      * @param begin The first iterator of the container with event type
      * @param end The last iterator of the container with event type
+     * @param shardsCount The number of delivery shards (see above)
      * @return A shared pointer to the new Subscription object or Subscription::INVALID
      */
-    template <typename EventTypeIt> Subscription::Ptr createSubscription(EventTypeIt begin, EventTypeIt end) {
-        return createSubscription(EventTypesMask(begin, end));
+    template <typename EventTypeIt>
+    Subscription::Ptr createSubscription(EventTypeIt begin, EventTypeIt end, std::size_t shardsCount = 1) {
+        return createSubscription(EventTypesMask(begin, end), shardsCount);
     }
 
     /**
@@ -213,10 +288,36 @@ struct Connection final : public std::enable_shared_from_this<Connection> {
      * inferred by event type.
      *
      * @param eventTypes The initializer list with event types
+     * @param shardsCount The number of delivery shards (see above)
      * @return A shared pointer to the new Subscription object or Subscription::INVALID
      */
-    Subscription::Ptr createSubscription(std::initializer_list<EventType> eventTypes) {
-        return createSubscription(eventTypes.begin(), eventTypes.end());
+    Subscription::Ptr createSubscription(std::initializer_list<EventType> eventTypes, std::size_t shardsCount = 1) {
+        return createSubscription(eventTypes.begin(), eventTypes.end(), shardsCount);
+    }
+
+    /**
+     * Creates the new subscription to the events of the types Es. The event types mask is derived at compile time, and
+     * the listeners are registered per type: `sub->on<Quote>() += [](const Quote::Ptr &quote) {...}`.
+     *
+     * @tparam Es The event types (any of the EventRegistry::Types)
+     * @param shardsCount The number of per-symbol delivery shards of each event type
+     * @return A shared pointer to the new TypedSubscription object or TypedSubscription::INVALID
+     */
+    template <typename... Es>
+    typename TypedSubscription<Es...>::Ptr createTypedSubscription(std::size_t shardsCount = 1) {
+        std::lock_guard<std::recursive_mutex> lock{mutex_};
+
+        if (connectionHandle_ == nullptr) {
+            return TypedSubscription<Es...>::INVALID;
+        }
+
+        auto sub = TypedSubscription<Es...>::create(connectionHandle_, dispatcher_, shardsCount);
+
+        if (sub) {
+            typedSubscriptions_.push_back(sub);
+        }
+
+        return sub;
     }
 
     /**
@@ -235,7 +336,7 @@ struct Connection final : public std::enable_shared_from_this<Connection> {
             return TimeSeriesSubscription::INVALID;
         }
 
-        auto sub = TimeSeriesSubscription::create(connectionHandle_, eventTypesMask, fromTime);
+        auto sub = TimeSeriesSubscription::create(connectionHandle_, eventTypesMask, fromTime, dispatcher_);
 
         if (sub) {
             timeSeriesSubscriptions_.push_back(sub);
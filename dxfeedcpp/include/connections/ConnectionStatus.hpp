@@ -8,12 +8,14 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <utility>
 
 #include "common/DXFCppConfig.hpp"
 
+#include "utils/Utils.hpp"
+
 namespace std {
 
 ///
@@ -27,13 +29,20 @@ namespace dxfcpp {
 
 /**
  * Wrapper over the dxf_connection_status_t enum
+ *
+ * It is a one-byte literal type with the static table of the names (see OrderScope).
  */
-class ConnectionStatus {
-    dxf_connection_status_t status_;
-    std::string string_;
+class ConnectionStatus final {
+    // The C-API value of the status
+    std::uint8_t code_;
+
+    static DXFCPP_USE_CONSTEXPR std::uint8_t COUNT = 4;
 
-    ConnectionStatus(dxf_connection_status_t status, std::string string)
-        : status_{status}, string_{std::move(string)} {}
+    template <typename = void> struct Names {
+        static const StringView VALUES[];
+    };
+
+    explicit DXFCPP_CONSTEXPR ConnectionStatus(std::uint8_t code) noexcept : code_{code} {}
 
   public:
     ///
@@ -45,21 +54,34 @@ class ConnectionStatus {
     ///
     static const ConnectionStatus AUTHORIZED;
 
-    ///
-    const static std::unordered_map<dxf_connection_status_t, ConnectionStatus> ALL;
-
     /**
+     * Returns the wrapper of the C-API status
      *
-     * @param status
-     * @return
+     * @param status The C-API status
+     * @return The wrapper or NOT_CONNECTED if the status is unknown
      */
-    static ConnectionStatus get(dxf_connection_status_t status) { return ALL.at(status); }
+    static DXFCPP_CONSTEXPR ConnectionStatus get(dxf_connection_status_t status) noexcept {
+        return ConnectionStatus(static_cast<int>(status) >= 0 && static_cast<int>(status) < COUNT
+                                    ? static_cast<std::uint8_t>(status)
+                                    : static_cast<std::uint8_t>(dxf_cs_not_connected));
+    }
+
+    ///
+    DXFCPP_CONSTEXPR dxf_connection_status_t getStatus() const noexcept {
+        return static_cast<dxf_connection_status_t>(code_);
+    }
+
+    ///
+    StringView getName() const noexcept { return Names<>::VALUES[code_]; }
 
     ///
-    dxf_connection_status_t getStatus() const { return status_; }
+    std::string toString() const { return getName().toString(); }
 
     ///
-    std::string toString() const { return string_; }
+    DXFCPP_CONSTEXPR bool operator==(const ConnectionStatus &other) const noexcept { return code_ == other.code_; }
+
+    ///
+    DXFCPP_CONSTEXPR bool operator!=(const ConnectionStatus &other) const noexcept { return code_ != other.code_; }
 
     /**
      *
@@ -69,18 +91,16 @@ class ConnectionStatus {
      * @return
      */
     template <class Ostream> friend Ostream &&operator<<(Ostream &&os, const ConnectionStatus &value) {
-        return std::forward<Ostream>(os) << value.toString();
+        return std::forward<Ostream>(os) << value.getName();
     }
 };
 
-const ConnectionStatus ConnectionStatus::NOT_CONNECTED{dxf_cs_not_connected, "Not connected"};
-const ConnectionStatus ConnectionStatus::CONNECTED{dxf_cs_connected, "Connected"};
-const ConnectionStatus ConnectionStatus::LOGIN_REQUIRED{dxf_cs_login_required, "Login required"};
-const ConnectionStatus ConnectionStatus::AUTHORIZED{dxf_cs_authorized, "Authorized"};
-
-const std::unordered_map<dxf_connection_status_t, ConnectionStatus> ConnectionStatus::ALL{
-    {NOT_CONNECTED.getStatus(), NOT_CONNECTED},
-    {CONNECTED.getStatus(), CONNECTED},
-    {LOGIN_REQUIRED.getStatus(), LOGIN_REQUIRED},
-    {AUTHORIZED.getStatus(), AUTHORIZED}};
-} // namespace dxfcpp
\ No newline at end of file
+template <typename T>
+const StringView ConnectionStatus::Names<T>::VALUES[] = {"Not connected", "Connected", "Login required", "Authorized"};
+
+DXFCPP_USE_CONSTEXPR ConnectionStatus ConnectionStatus::NOT_CONNECTED{dxf_cs_not_connected};
+DXFCPP_USE_CONSTEXPR ConnectionStatus ConnectionStatus::CONNECTED{dxf_cs_connected};
+DXFCPP_USE_CONSTEXPR ConnectionStatus ConnectionStatus::LOGIN_REQUIRED{dxf_cs_login_required};
+DXFCPP_USE_CONSTEXPR ConnectionStatus ConnectionStatus::AUTHORIZED{dxf_cs_authorized};
+
+} // namespace dxfcpp
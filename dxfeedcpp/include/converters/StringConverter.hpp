@@ -11,28 +11,367 @@
 #    pragma warning(disable : 4244)
 #endif
 
-#include <codecvt>
+#if DXFCPP_USE_SSE2
+#    include <emmintrin.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cwchar>
 #include <sstream>
+#include <string>
 
 namespace dxfcpp {
 
-///
+/**
+ * The thread-safe UTF-8 <-> wide string (UTF-16 or UTF-32, depending on the size of wchar_t) transcoder.
+ *
+ * The conversion does not throw and does not allocate when the caller provides the buffer. ASCII runs are converted
+ * by blocks (with SSE2 when it is available). Invalid sequences (lone surrogates, malformed UTF-8, etc.) are
+ * replaced by REPLACEMENT_CHARACTER.
+ */
 struct StringConverter {
-    static std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> wstringConvert;
+    /// The character that replaces invalid sequences
+    static DXFCPP_USE_CONSTEXPR std::uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+  private:
+    // The size of the on-stack buffer of the functions that return strings
+    static DXFCPP_USE_CONSTEXPR std::size_t SMALL_BUFFER_SIZE = 128;
+
+    // The number of wide characters converted by one block
+    static DXFCPP_USE_CONSTEXPR std::size_t WIDE_BLOCK_SIZE = sizeof(wchar_t) == 2 ? 16 : 8;
+
+    // The number of UTF-8 characters converted by one block
+    static DXFCPP_USE_CONSTEXPR std::size_t UTF8_BLOCK_SIZE = 16;
+
+    static bool isHighSurrogate(std::uint32_t unit) noexcept { return unit >= 0xD800 && unit <= 0xDBFF; }
+
+    static bool isLowSurrogate(std::uint32_t unit) noexcept { return unit >= 0xDC00 && unit <= 0xDFFF; }
+
+    static std::uint32_t toUnit(wchar_t c) noexcept {
+        return sizeof(wchar_t) == 2 ? static_cast<std::uint16_t>(c) : static_cast<std::uint32_t>(c);
+    }
+
+    static std::size_t encodeUtf8(std::uint32_t codePoint, char *utf8) noexcept {
+        if (codePoint < 0x80) {
+            utf8[0] = static_cast<char>(codePoint);
+
+            return 1;
+        }
+
+        if (codePoint < 0x800) {
+            utf8[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+            utf8[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+
+            return 2;
+        }
+
+        if (codePoint < 0x10000) {
+            utf8[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+            utf8[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            utf8[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+
+            return 3;
+        }
+
+        utf8[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+        utf8[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        utf8[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        utf8[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+
+        return 4;
+    }
+
+    static std::size_t encodeWide(std::uint32_t codePoint, wchar_t *wide) noexcept {
+        if (sizeof(wchar_t) == 2 && codePoint >= 0x10000) {
+            codePoint -= 0x10000;
+            wide[0] = static_cast<wchar_t>(0xD800 + (codePoint >> 10));
+            wide[1] = static_cast<wchar_t>(0xDC00 + (codePoint & 0x3FF));
+
+            return 2;
+        }
+
+        wide[0] = static_cast<wchar_t>(codePoint);
+
+        return 1;
+    }
+
+    // Converts WIDE_BLOCK_SIZE characters if all of them are ASCII
+    static bool convertAsciiBlock(const wchar_t *wide, char *utf8) noexcept {
+#if DXFCPP_USE_SSE2
+        auto first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(wide));
+        auto second = _mm_loadu_si128(reinterpret_cast<const __m128i *>(wide) + 1);
+        auto zero = _mm_setzero_si128();
+
+        if (sizeof(wchar_t) == 2) {
+            auto nonAscii = _mm_and_si128(_mm_or_si128(first, second), _mm_set1_epi16(-0x80));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xFFFF) {
+                return false;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(utf8), _mm_packus_epi16(first, second));
+        } else {
+            auto nonAscii = _mm_and_si128(_mm_or_si128(first, second), _mm_set1_epi32(-0x80));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(nonAscii, zero)) != 0xFFFF) {
+                return false;
+            }
+
+            auto packed = _mm_packs_epi32(first, second);
+
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(utf8), _mm_packus_epi16(packed, packed));
+        }
+
+        return true;
+#else
+        std::uint32_t nonAscii = 0;
+
+        for (std::size_t i = 0; i < WIDE_BLOCK_SIZE; i++) {
+            nonAscii |= toUnit(wide[i]);
+        }
+
+        if (nonAscii >= 0x80) {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < WIDE_BLOCK_SIZE; i++) {
+            utf8[i] = static_cast<char>(wide[i]);
+        }
+
+        return true;
+#endif
+    }
+
+    // Converts UTF8_BLOCK_SIZE characters if all of them are ASCII
+    static bool convertAsciiBlock(const char *utf8, wchar_t *wide) noexcept {
+#if DXFCPP_USE_SSE2
+        auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8));
+
+        if (_mm_movemask_epi8(bytes) != 0) {
+            return false;
+        }
+
+        auto zero = _mm_setzero_si128();
+        auto low = _mm_unpacklo_epi8(bytes, zero);
+        auto high = _mm_unpackhi_epi8(bytes, zero);
+        auto out = reinterpret_cast<__m128i *>(wide);
+
+        if (sizeof(wchar_t) == 2) {
+            _mm_storeu_si128(out, low);
+            _mm_storeu_si128(out + 1, high);
+        } else {
+            _mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+        }
+
+        return true;
+#else
+        std::uint64_t first{}, second{};
+
+        std::memcpy(&first, utf8, sizeof(first));
+        std::memcpy(&second, utf8 + sizeof(first), sizeof(second));
+
+        if (((first | second) & 0x8080808080808080ULL) != 0) {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < UTF8_BLOCK_SIZE; i++) {
+            wide[i] = static_cast<wchar_t>(utf8[i]);
+        }
+
+        return true;
+#endif
+    }
+
+  public:
+    /**
+     * Returns the size of the buffer that is enough to convert the wide string to UTF-8
+     *
+     * @param wideLength The length of the wide string
+     * @return The size of the buffer in chars
+     */
+    static DXFCPP_CONSTEXPR std::size_t getMaxUtf8Length(std::size_t wideLength) noexcept {
+        return wideLength * (sizeof(wchar_t) == 2 ? 3 : 4);
+    }
+
+    /**
+     * Returns the size of the buffer that is enough to convert the UTF-8 string to the wide string
+     *
+     * @param utf8Length The length of the UTF-8 string
+     * @return The size of the buffer in wide chars
+     */
+    static DXFCPP_CONSTEXPR std::size_t getMaxWideLength(std::size_t utf8Length) noexcept { return utf8Length; }
+
+    /**
+     * Converts the wide string to UTF-8
+     *
+     * @param wide The wide string (UTF-16 or UTF-32)
+     * @param length The length of the wide string
+     * @param utf8 The buffer of at least getMaxUtf8Length(length) chars. The result is not null-terminated.
+     * @return The length of the result
+     */
+    static std::size_t wStringToUtf8(const wchar_t *wide, std::size_t length, char *utf8) noexcept {
+        std::size_t i = 0;
+        std::size_t result = 0;
+
+        while (i < length) {
+            auto scalarEnd = length;
+
+            if (length - i >= WIDE_BLOCK_SIZE) {
+                if (convertAsciiBlock(wide + i, utf8 + result)) {
+                    i += WIDE_BLOCK_SIZE;
+                    result += WIDE_BLOCK_SIZE;
+
+                    continue;
+                }
+
+                scalarEnd = i + WIDE_BLOCK_SIZE;
+            }
+
+            while (i < scalarEnd) {
+                auto unit = toUnit(wide[i++]);
+
+                if (unit < 0x80) {
+                    utf8[result++] = static_cast<char>(unit);
+
+                    continue;
+                }
+
+                auto codePoint = unit;
+
+                if (isHighSurrogate(unit)) {
+                    if (i < length && isLowSurrogate(toUnit(wide[i]))) {
+                        codePoint = 0x10000 + ((unit - 0xD800) << 10) + (toUnit(wide[i++]) - 0xDC00);
+                    } else {
+                        codePoint = REPLACEMENT_CHARACTER;
+                    }
+                } else if (isLowSurrogate(unit) || unit > 0x10FFFF) {
+                    codePoint = REPLACEMENT_CHARACTER;
+                }
+
+                result += encodeUtf8(codePoint, utf8 + result);
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Converts the UTF-8 string to the wide string
+     *
+     * @param utf8 The UTF-8 string
+     * @param length The length of the UTF-8 string
+     * @param wide The buffer of at least getMaxWideLength(length) wide chars. The result is not null-terminated.
+     * @return The length of the result
+     */
+    static std::size_t utf8ToWString(const char *utf8, std::size_t length, wchar_t *wide) noexcept {
+        std::size_t i = 0;
+        std::size_t result = 0;
+
+        while (i < length) {
+            auto scalarEnd = length;
+
+            if (length - i >= UTF8_BLOCK_SIZE) {
+                if (convertAsciiBlock(utf8 + i, wide + result)) {
+                    i += UTF8_BLOCK_SIZE;
+                    result += UTF8_BLOCK_SIZE;
+
+                    continue;
+                }
+
+                scalarEnd = i + UTF8_BLOCK_SIZE;
+            }
+
+            while (i < scalarEnd) {
+                auto lead = static_cast<std::uint8_t>(utf8[i]);
+
+                if (lead < 0x80) {
+                    wide[result++] = static_cast<wchar_t>(lead);
+                    i++;
+
+                    continue;
+                }
+
+                std::uint32_t codePoint{};
+                std::uint32_t minCodePoint{};
+                std::size_t continuationsCount{};
+
+                if ((lead & 0xE0) == 0xC0) {
+                    codePoint = lead & 0x1F;
+                    minCodePoint = 0x80;
+                    continuationsCount = 1;
+                } else if ((lead & 0xF0) == 0xE0) {
+                    codePoint = lead & 0x0F;
+                    minCodePoint = 0x800;
+                    continuationsCount = 2;
+                } else if ((lead & 0xF8) == 0xF0) {
+                    codePoint = lead & 0x07;
+                    minCodePoint = 0x10000;
+                    continuationsCount = 3;
+                }
+
+                bool valid = continuationsCount != 0 && length - i > continuationsCount;
+
+                for (std::size_t k = 1; valid && k <= continuationsCount; k++) {
+                    auto continuation = static_cast<std::uint8_t>(utf8[i + k]);
+
+                    valid = (continuation & 0xC0) == 0x80;
+                    codePoint = (codePoint << 6) | (continuation & 0x3F);
+                }
+
+                if (!valid || codePoint < minCodePoint || codePoint > 0x10FFFF || isHighSurrogate(codePoint) ||
+                    isLowSurrogate(codePoint)) {
+                    wide[result++] = static_cast<wchar_t>(REPLACEMENT_CHARACTER);
+                    i++;
+
+                    continue;
+                }
+
+                i += continuationsCount + 1;
+                result += encodeWide(codePoint, wide + result);
+            }
+        }
+
+        return result;
+    }
 
     /**
      *
      * @param utf8
+     * @param length
      * @return
      */
-    static std::wstring utf8ToWString(const std::string &utf8) noexcept {
+    static std::wstring utf8ToWString(const char *utf8, std::size_t length) noexcept {
         try {
-            return wstringConvert.from_bytes(utf8);
+            if (getMaxWideLength(length) <= SMALL_BUFFER_SIZE) {
+                wchar_t buffer[SMALL_BUFFER_SIZE];
+
+                return std::wstring(buffer, utf8ToWString(utf8, length, buffer));
+            }
+
+            std::wstring result(getMaxWideLength(length), L'\0');
+
+            result.resize(utf8ToWString(utf8, length, &result[0]));
+
+            return result;
         } catch (...) {
             return {};
         }
     }
 
+    /**
+     *
+     * @param utf8
+     * @return
+     */
+    static std::wstring utf8ToWString(const std::string &utf8) noexcept {
+        return utf8ToWString(utf8.data(), utf8.size());
+    }
+
     /**
      *
      * @param utf8
@@ -43,11 +382,7 @@ struct StringConverter {
             return {};
         }
 
-        try {
-            return wstringConvert.from_bytes(utf8);
-        } catch (...) {
-            return {};
-        }
+        return utf8ToWString(utf8, std::strlen(utf8));
     }
 
     /**
@@ -56,26 +391,44 @@ struct StringConverter {
      * @return
      */
     static wchar_t utf8ToWChar(char c) noexcept {
-        if (c == '\0') {
-            return L'\0';
-        }
+        auto unit = static_cast<std::uint8_t>(c);
 
-        return utf8ToWString(std::string(1, c))[0];
+        return unit < 0x80 ? static_cast<wchar_t>(unit) : static_cast<wchar_t>(REPLACEMENT_CHARACTER);
     }
 
     /**
      *
-     * @param utf16
+     * @param wide
+     * @param length
      * @return
      */
-    static std::string wStringToUtf8(const std::wstring &utf16) noexcept {
+    static std::string wStringToUtf8(const wchar_t *wide, std::size_t length) noexcept {
         try {
-            return wstringConvert.to_bytes(utf16);
+            if (getMaxUtf8Length(length) <= SMALL_BUFFER_SIZE) {
+                char buffer[SMALL_BUFFER_SIZE];
+
+                return std::string(buffer, wStringToUtf8(wide, length, buffer));
+            }
+
+            std::string result(getMaxUtf8Length(length), '\0');
+
+            result.resize(wStringToUtf8(wide, length, &result[0]));
+
+            return result;
         } catch (...) {
             return {};
         }
     }
 
+    /**
+     *
+     * @param utf16
+     * @return
+     */
+    static std::string wStringToUtf8(const std::wstring &utf16) noexcept {
+        return wStringToUtf8(utf16.data(), utf16.size());
+    }
+
     /**
      *
      * @param utf16
@@ -86,11 +439,7 @@ struct StringConverter {
             return {};
         }
 
-        try {
-            return wstringConvert.to_bytes(utf16);
-        } catch (...) {
-            return {};
-        }
+        return wStringToUtf8(utf16, std::wcslen(utf16));
     }
 
     /**
@@ -99,16 +448,20 @@ struct StringConverter {
      * @return
      */
     static char wCharToUtf8(wchar_t c) noexcept {
-        if (c == L'\0') {
-            return '\0';
+        auto unit = toUnit(c);
+
+        if (unit < 0x80) {
+            return static_cast<char>(unit);
         }
 
-        return wStringToUtf8(std::wstring(1, c))[0];
+        char buffer[4];
+
+        wStringToUtf8(&c, 1, buffer);
+
+        return buffer[0];
     }
 };
 
-std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> StringConverter::wstringConvert{};
-
 inline std::string exchangeCodeToString(char c) {
     if (c >= 32 && c <= 126) {
         return std::string() + c;
@@ -129,4 +482,4 @@ inline std::string exchangeCodeToString(char c) {
 
 #ifdef _MSC_FULL_VER
 #    pragma warning(pop)
-#endif
\ No newline at end of file
+#endif
@@ -8,7 +8,9 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "common/DXFCppConfig.hpp"
@@ -18,9 +20,39 @@ extern "C" {
 #include "Event.hpp"
 #include "EventFlags.hpp"
 #include "EventTraits.hpp"
+#include "EventView.hpp"
 
 namespace dxfcpp {
 
+/**
+ * The compact trivially copyable record of the Candle fields: the symbol is stored as the SymbolTable id, the event
+ * flags are stored as the mask, and the fields are ordered by size (128 bytes on the most platforms). The records can
+ * be kept by value in flat arrays and can be copied by memcpy. Candle::toRecord() and CandleView::toRecord() create the
+ * record, Candle(const CandleRecord &) restores the event.
+ */
+struct CandleRecord {
+    std::uint64_t eventTime;
+    std::uint64_t index;
+    std::uint64_t time;
+    std::uint64_t count;
+    double open;
+    double high;
+    double low;
+    double close;
+    double volume;
+    double vwap;
+    double bidVolume;
+    double askVolume;
+    double impVolatility;
+    double openInterest;
+    SymbolTable::IdType eventSymbolId;
+    std::int32_t sequence;
+    std::uint32_t eventFlags;
+};
+
+static_assert(std::is_trivially_copyable<CandleRecord>::value, "CandleRecord must be trivially copyable");
+static_assert(sizeof(CandleRecord) <= 128, "CandleRecord must fit in two cache lines");
+
 /**
  * @brief Candle
  *
@@ -30,8 +62,14 @@ struct Candle final : public Event, public TimeSeries, public Lasting {
     /// The alias to a type of shared pointer to the Candle object
     using Ptr = std::shared_ptr<Candle>;
 
+    /// The alias to a type of intrusive handle to the Candle object
+    using Handle = IntrusivePtr<Candle>;
+
+    /// The alias to a type of the compact record of the Candle fields
+    using Record = CandleRecord;
+
   private:
-    std::string eventSymbol_{};
+    SymbolTable::IdType eventSymbolId_{SymbolTable::EMPTY_SYMBOL_ID};
     /// Transactional event flags
     EventFlagsMask eventFlags_{};
 
@@ -63,10 +101,10 @@ struct Candle final : public Event, public TimeSeries, public Lasting {
     double openInterest_{std::numeric_limits<double>::quiet_NaN()};
 
   public:
-    Candle() = default;
+    Candle() : Event(EventTraits<Candle>::cApiEventId) {}
 
     Candle(const Candle &other)
-        : eventSymbol_{other.eventSymbol_}, eventFlags_{other.eventFlags_},
+        : Event(other), eventSymbolId_{other.eventSymbolId_}, eventFlags_{other.eventFlags_},
           eventTime_{other.eventTime_}, index_{other.index_}, time_{other.time_}, sequence_{other.sequence_},
           count_{other.count_}, open_{other.open_}, high_{other.high_}, low_{other.low_}, close_{other.close_},
           volume_{other.volume_}, vwap_{other.vwap_}, bidVolume_{other.bidVolume_}, askVolume_{other.askVolume_},
@@ -75,7 +113,7 @@ struct Candle final : public Event, public TimeSeries, public Lasting {
     Candle &operator=(const Candle &other) = delete;
 
     Candle(Candle &&other) noexcept
-        : eventSymbol_{std::move(other.eventSymbol_)}, eventFlags_{other.eventFlags_},
+        : Event(std::move(other)), eventSymbolId_{other.eventSymbolId_}, eventFlags_{other.eventFlags_},
           eventTime_{other.eventTime_}, index_{other.index_}, time_{other.time_}, sequence_{other.sequence_},
           count_{other.count_}, open_{other.open_}, high_{other.high_}, low_{other.low_}, close_{other.close_},
           volume_{other.volume_}, vwap_{other.vwap_}, bidVolume_{other.bidVolume_}, askVolume_{other.askVolume_},
@@ -83,18 +121,58 @@ struct Candle final : public Event, public TimeSeries, public Lasting {
 
     Candle &operator=(Candle &&other) noexcept = delete;
 
-    explicit Candle(std::string eventSymbol) : eventSymbol_{std::move(eventSymbol)} {}
+    explicit Candle(const std::string &eventSymbol)
+        : Event(EventTraits<Candle>::cApiEventId), eventSymbolId_{SymbolTable::getInstance().intern(eventSymbol)} {}
+
+    Candle(const std::string &eventSymbol, const dxf_candle_t &candle)
+        : Candle(SymbolTable::getInstance().intern(eventSymbol), candle) {}
 
-    Candle(std::string eventSymbol, const dxf_candle_t &candle)
-        : eventSymbol_{std::move(eventSymbol)},
+    Candle(SymbolTable::IdType eventSymbolId, const dxf_candle_t &candle)
+        : Event(EventTraits<Candle>::cApiEventId), eventSymbolId_{eventSymbolId},
           eventFlags_(candle.event_flags), eventTime_{0}, index_{static_cast<std::uint64_t>(candle.index)},
           time_{static_cast<std::uint64_t>(candle.time)}, sequence_{candle.sequence},
           count_{static_cast<std::uint64_t>(candle.count)}, open_{candle.open}, high_{candle.high}, low_{candle.low},
           close_{candle.close}, volume_{candle.volume}, vwap_{candle.vwap}, bidVolume_{candle.bid_volume},
-          askVolume_{candle.ask_volume}, impVolatility_{candle.ask_volume}, openInterest_{candle.open_interest} {}
+          askVolume_{candle.ask_volume}, impVolatility_{candle.imp_volatility}, openInterest_{candle.open_interest} {}
+
+    /**
+     * Creates new candle with the fields of the record
+     *
+     * @param record The record
+     */
+    explicit Candle(const CandleRecord &record)
+        : Event(EventTraits<Candle>::cApiEventId), eventSymbolId_{record.eventSymbolId},
+          eventFlags_(record.eventFlags), eventTime_{record.eventTime}, index_{record.index}, time_{record.time},
+          sequence_{record.sequence}, count_{record.count}, open_{record.open}, high_{record.high}, low_{record.low},
+          close_{record.close}, volume_{record.volume}, vwap_{record.vwap}, bidVolume_{record.bidVolume},
+          askVolume_{record.askVolume}, impVolatility_{record.impVolatility}, openInterest_{record.openInterest} {}
 
-    const std::string &getEventSymbol() const override { return eventSymbol_; }
-    void setEventSymbol(const std::string &eventSymbol) override { eventSymbol_ = eventSymbol; }
+    /// Returns the compact record of the fields of this candle
+    CandleRecord toRecord() const {
+        return CandleRecord{eventTime_,
+                            index_,
+                            time_,
+                            count_,
+                            open_,
+                            high_,
+                            low_,
+                            close_,
+                            volume_,
+                            vwap_,
+                            bidVolume_,
+                            askVolume_,
+                            impVolatility_,
+                            openInterest_,
+                            eventSymbolId_,
+                            sequence_,
+                            eventFlags_.getMask()};
+    }
+
+    const std::string &getEventSymbol() const override { return SymbolTable::getInstance().getSymbol(eventSymbolId_); }
+    void setEventSymbol(const std::string &eventSymbol) override {
+        eventSymbolId_ = SymbolTable::getInstance().intern(eventSymbol);
+    }
+    SymbolTable::IdType getEventSymbolId() const override { return eventSymbolId_; }
     uint64_t getEventTime() const override { return eventTime_; }
     void setEventTime(std::uint64_t eventTime) override { eventTime_ = eventTime; }
     const IndexedEventSource &getSource() const override { return IndexedEventSource::DEFAULT; }
@@ -103,9 +181,21 @@ struct Candle final : public Event, public TimeSeries, public Lasting {
     uint64_t getIndex() const override { return index_; }
     void setIndex(std::uint64_t index) override { index_ = index; }
     uint64_t getTime() const override { return time_; }
+    std::int32_t getSequence() const { return sequence_; }
+    std::uint64_t getCount() const { return count_; }
+    double getOpen() const { return open_; }
+    double getHigh() const { return high_; }
+    double getLow() const { return low_; }
+    double getClose() const { return close_; }
+    double getVolume() const { return volume_; }
+    double getVWAP() const { return vwap_; }
+    double getBidVolume() const { return bidVolume_; }
+    double getAskVolume() const { return askVolume_; }
+    double getImpVolatility() const { return impVolatility_; }
+    double getOpenInterest() const { return openInterest_; }
 
     std::string toString() const override {
-        return std::string("Candle{") + eventSymbol_ + ", index=" + std::to_string(index_) +
+        return std::string("Candle{") + getEventSymbol() + ", index=" + std::to_string(index_) +
             ", eventTime=" + DateTimeConverter::toISO(eventTime_) + ", eventFlags=" + eventFlags_.toString() +
             ", time=" + DateTimeConverter::toISO(time_) + ", sequence=" + std::to_string(sequence_) +
             ", count=" + std::to_string(count_) + ", open=" + std::to_string(open_) +
@@ -122,4 +212,53 @@ struct Candle final : public Event, public TimeSeries, public Lasting {
 
     ~Candle() override = default;
 };
+
+/**
+ * The non-owning view of the dxFeed C-API candle with the same getters as Candle. It is valid only during the listener
+ * call (see SubscriptionImpl::onView); materialize() creates the Candle.
+ */
+struct CandleView final : public EventView<Candle, dxf_candle_t> {
+    using EventView<Candle, dxf_candle_t>::EventView;
+
+    const IndexedEventSource &getSource() const { return IndexedEventSource::DEFAULT; }
+    EventFlagsMask getEventFlags() const { return EventFlagsMask(getData().event_flags); }
+    std::uint64_t getIndex() const { return static_cast<std::uint64_t>(getData().index); }
+    std::uint64_t getTime() const { return static_cast<std::uint64_t>(getData().time); }
+    std::int32_t getSequence() const { return getData().sequence; }
+    std::uint64_t getCount() const { return static_cast<std::uint64_t>(getData().count); }
+    double getOpen() const { return getData().open; }
+    double getHigh() const { return getData().high; }
+    double getLow() const { return getData().low; }
+    double getClose() const { return getData().close; }
+    double getVolume() const { return getData().volume; }
+    double getVWAP() const { return getData().vwap; }
+    double getBidVolume() const { return getData().bid_volume; }
+    double getAskVolume() const { return getData().ask_volume; }
+    double getImpVolatility() const { return getData().imp_volatility; }
+    double getOpenInterest() const { return getData().open_interest; }
+
+    /// Returns the compact record of the fields of the candle (without creating the Candle)
+    CandleRecord toRecord() const {
+        const auto &data = getData();
+
+        return CandleRecord{getEventTime(),
+                            getIndex(),
+                            getTime(),
+                            getCount(),
+                            data.open,
+                            data.high,
+                            data.low,
+                            data.close,
+                            data.volume,
+                            data.vwap,
+                            data.bid_volume,
+                            data.ask_volume,
+                            data.imp_volatility,
+                            data.open_interest,
+                            getEventSymbolId(),
+                            data.sequence,
+                            data.event_flags};
+    }
+};
+
 } // namespace dxfcpp
\ No newline at end of file
@@ -8,12 +8,14 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
 #include <string>
 #include <utility>
 
 #include "common/DXFCppConfig.hpp"
 
 #include "converters/DateTimeConverter.hpp"
+#include "converters/StringConverter.hpp"
 
 #include "Event.hpp"
 #include "EventFlags.hpp"
@@ -21,16 +23,81 @@ extern "C" {
 
 namespace dxfcpp {
 
-struct Configuration final : virtual public Event, virtual public Lasting {
+/**
+ * An event with an application-specific attachment.
+ */
+struct Configuration final : public Event, public Lasting {
+    /// The alias to a type of shared pointer to the Configuration object
+    using Ptr = std::shared_ptr<Configuration>;
+
+    /// The alias to a type of intrusive handle to the Configuration object
+    using Handle = IntrusivePtr<Configuration>;
+
   private:
-    std::string eventSymbol_{};
+    SymbolTable::IdType eventSymbolId_{SymbolTable::EMPTY_SYMBOL_ID};
+    /// Time when event was created or zero when time is not available
+    std::uint64_t eventTime_{};
+    /// Version of this configuration
+    std::int32_t version_{};
+    /// The attachment of this configuration (the UTF-8 representation of the C-API object)
+    std::string attachment_{};
 
   public:
-    std::string toString() const override { return std::string(); }
-    const std::string &getEventSymbol() const override { return eventSymbol_; }
-    void setEventSymbol(const std::string &string) override {}
-    uint64_t getEventTime() const override { return 0; }
-    void setEventTime(std::uint64_t uint64) override {}
+    /**
+     * Creates new configuration event with the specified event symbol
+     *
+     * @param eventSymbol The event symbol
+     */
+    explicit Configuration(const std::string &eventSymbol)
+        : Event(EventTraits<Configuration>::cApiEventId),
+          eventSymbolId_{SymbolTable::getInstance().intern(eventSymbol)} {}
+
+    /**
+     * Creates new configuration event with the specified event symbol and dxFeed C-API dxf_configuration_t
+     *
+     * @param eventSymbol The event symbol
+     * @param configuration The dxFeed C-API dxf_configuration_t object
+     */
+    Configuration(const std::string &eventSymbol, const dxf_configuration_t &configuration)
+        : Configuration(SymbolTable::getInstance().intern(eventSymbol), configuration) {}
+
+    /**
+     * Creates new configuration event with the specified event symbol id and dxFeed C-API dxf_configuration_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param configuration The dxFeed C-API dxf_configuration_t object
+     */
+    Configuration(SymbolTable::IdType eventSymbolId, const dxf_configuration_t &configuration)
+        : Event(EventTraits<Configuration>::cApiEventId), eventSymbolId_{eventSymbolId},
+          version_{configuration.version}, attachment_{StringConverter::wStringToUtf8(configuration.object)} {}
+
+    Configuration &operator=(const Configuration &other) = delete;
+
+    Configuration &operator=(Configuration &&other) = delete;
+
+    const std::string &getEventSymbol() const override { return SymbolTable::getInstance().getSymbol(eventSymbolId_); }
+
+    void setEventSymbol(const std::string &eventSymbol) override {
+        eventSymbolId_ = SymbolTable::getInstance().intern(eventSymbol);
+    }
+
+    SymbolTable::IdType getEventSymbolId() const override { return eventSymbolId_; }
+
+    std::uint64_t getEventTime() const override { return eventTime_; }
+
+    void setEventTime(std::uint64_t eventTime) override { eventTime_ = eventTime; }
+
+    /// Returns version of this configuration
+    std::int32_t getVersion() const { return version_; }
+
+    /// Returns the attachment of this configuration
+    const std::string &getAttachment() const { return attachment_; }
+
+    /// Returns a string representation of the entity
+    std::string toString() const override {
+        return "Configuration{" + getEventSymbol() + ", eventTime=" + DateTimeConverter::toISO(eventTime_) +
+            ", version=" + std::to_string(version_) + ", attachment=" + attachment_ + '}';
+    }
 };
 
-} // namespace dxfcpp
\ No newline at end of file
+} // namespace dxfcpp
@@ -1,7 +1,5 @@
 #pragma once
 
-#pragma once
-
 #ifndef DXFEED_HPP_INCLUDED
 #    error Please include only the DXFeed.hpp header
 #endif
@@ -10,12 +8,14 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <utility>
 
 #include "common/DXFCppConfig.hpp"
 
+#include "utils/Utils.hpp"
+
 namespace std {
 
 template <> struct hash<dxf_direction_t> {
@@ -29,12 +29,20 @@ namespace dxfcpp {
 /**
  * Wrapper over the dxf_direction_t enum
  * Direction of the price movement. For example tick direction for last trade price.
+ *
+ * It is a one-byte literal type with the static table of the names (see OrderScope).
  */
-class Direction {
-    dxf_direction_t direction_;
-    std::string name_;
+class Direction final {
+    // The C-API value of the direction
+    std::uint8_t code_;
+
+    static DXFCPP_USE_CONSTEXPR std::uint8_t COUNT = 6;
+
+    template <typename = void> struct Names {
+        static const StringView VALUES[];
+    };
 
-    Direction(dxf_direction_t direction, std::string name) : direction_{direction}, name_{std::move(name)} {}
+    explicit DXFCPP_CONSTEXPR Direction(std::uint8_t code) noexcept : code_{code} {}
 
   public:
     /**
@@ -66,41 +74,36 @@ class Direction {
      */
     static const Direction UP;
 
-    const static std::unordered_map<dxf_direction_t, Direction> ALL;
-
-    static Direction get(dxf_direction_t direction) {
-        auto found = ALL.find(direction);
-
-        if (found != ALL.end()) {
-            return found->second;
-        }
-
-        return UNDEFINED;
+    /// Returns the wrapper of the C-API direction or UNDEFINED
+    static DXFCPP_CONSTEXPR Direction get(dxf_direction_t direction) noexcept {
+        return Direction(static_cast<int>(direction) >= 0 && static_cast<int>(direction) < COUNT
+                             ? static_cast<std::uint8_t>(direction)
+                             : static_cast<std::uint8_t>(dxf_dir_undefined));
     }
 
-    dxf_direction_t getDirection() const { return direction_; }
+    DXFCPP_CONSTEXPR dxf_direction_t getDirection() const noexcept { return static_cast<dxf_direction_t>(code_); }
 
-    const std::string &getName() const { return name_; }
+    StringView getName() const noexcept { return Names<>::VALUES[code_]; }
 
-    std::string toString() const { return name_; }
+    std::string toString() const { return getName().toString(); }
 
     template <class Ostream> friend Ostream &&operator<<(Ostream &&os, const Direction &value) {
-        return std::forward<Ostream>(os) << value.toString();
+        return std::forward<Ostream>(os) << value.getName();
     }
 
-    bool operator==(const Direction &other) { return direction_ == other.direction_; }
+    DXFCPP_CONSTEXPR bool operator==(const Direction &other) const noexcept { return code_ == other.code_; }
+
+    DXFCPP_CONSTEXPR bool operator!=(const Direction &other) const noexcept { return code_ != other.code_; }
 };
 
-const Direction Direction::UNDEFINED{dxf_dir_undefined, "UNDEFINED"};
-const Direction Direction::DOWN{dxf_dir_down, "DOWN"};
-const Direction Direction::ZERO_DOWN{dxf_dir_zero_down, "ZERO_DOWN"};
-const Direction Direction::ZERO{dxf_dir_zero, "ZERO"};
-const Direction Direction::ZERO_UP{dxf_dir_zero_up, "ZERO_UP"};
-const Direction Direction::UP{dxf_dir_up, "UP"};
+template <typename T>
+const StringView Direction::Names<T>::VALUES[] = {"UNDEFINED", "DOWN", "ZERO_DOWN", "ZERO", "ZERO_UP", "UP"};
 
-const std::unordered_map<dxf_direction_t, Direction> Direction::ALL{
-    {UNDEFINED.getDirection(), UNDEFINED}, {DOWN.getDirection(), DOWN},       {ZERO_DOWN.getDirection(), ZERO_DOWN},
-    {ZERO.getDirection(), ZERO},           {ZERO_UP.getDirection(), ZERO_UP}, {UP.getDirection(), UP},
-};
+DXFCPP_USE_CONSTEXPR Direction Direction::UNDEFINED{dxf_dir_undefined};
+DXFCPP_USE_CONSTEXPR Direction Direction::DOWN{dxf_dir_down};
+DXFCPP_USE_CONSTEXPR Direction Direction::ZERO_DOWN{dxf_dir_zero_down};
+DXFCPP_USE_CONSTEXPR Direction Direction::ZERO{dxf_dir_zero};
+DXFCPP_USE_CONSTEXPR Direction Direction::ZERO_UP{dxf_dir_zero_up};
+DXFCPP_USE_CONSTEXPR Direction Direction::UP{dxf_dir_up};
 
-} // namespace dxfcpp
\ No newline at end of file
+} // namespace dxfcpp
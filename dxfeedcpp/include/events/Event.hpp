@@ -6,10 +6,15 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
+#include "helpers/IntrusivePtr.hpp"
+#include "helpers/SymbolTable.hpp"
+
 #include "EventFlags.hpp"
 #include "EventSource.hpp"
+#include "EventTraits.hpp"
 
 namespace dxfcpp {
 
@@ -63,17 +68,115 @@ struct SharedEntity : public Entity, std::enable_shared_from_this<SharedEntity>
     }
 };
 
-/// Marks all event types that can be received via dxFeed API.
-struct Event : public SharedEntity {
+/**
+ * Marks all event types that can be received via dxFeed API.
+ *
+ * The events can be held both by std::shared_ptr (Event::Ptr) and by the intrusive handles (Event::Handle). The
+ * handles are opt-in: they avoid the control block and the weak pointer traffic only in the code that passes them
+ * along (Handler, the processors that override process(Handle)), while every event pays for the counter of
+ * IntrusiveRefCounted (16 bytes) and the shared pointer API works as before.
+ */
+struct Event : public SharedEntity, public IntrusiveRefCounted {
     ///
     using Ptr = std::shared_ptr<Event>;
 
+    /// The alias to a type of intrusive handle to the Event object (see IntrusivePtr)
+    using Handle = IntrusivePtr<Event>;
+
+    /// The type tag of the events whose types have no EventTraits specialization
+    static DXFCPP_USE_CONSTEXPR unsigned UNKNOWN_TYPE_TAG = static_cast<unsigned>(-1);
+
+  private:
+    unsigned typeTag_ = UNKNOWN_TYPE_TAG;
+
+    // The events that are created by makeIntrusive() have no std::shared_ptr owner, so they are wrapped by a new handle
+    std::shared_ptr<Event> getSharedPtr() {
+        auto handle = Handle::fromObject(this);
+
+        if (handle) {
+            return toSharedPtr(std::move(handle));
+        }
+
+        return std::static_pointer_cast<Event>(shared_from_this());
+    }
+
+    template <typename T> std::shared_ptr<T> fastAs(std::true_type /* has the type tag */) {
+        if (typeTag_ != EventTraits<T>::cApiEventId) {
+            return {};
+        }
+
+        return std::static_pointer_cast<T>(getSharedPtr());
+    }
+
+    template <typename T> std::shared_ptr<T> fastAs(std::false_type /* has the type tag */) {
+        return std::dynamic_pointer_cast<T>(getSharedPtr());
+    }
+
+    template <typename T> T *fastCast(std::true_type /* has the type tag */) noexcept {
+        return typeTag_ == EventTraits<T>::cApiEventId ? static_cast<T *>(this) : nullptr;
+    }
+
+    template <typename T> T *fastCast(std::false_type /* has the type tag */) noexcept {
+        return dynamic_cast<T *>(this);
+    }
+
+  protected:
+    Event() noexcept = default;
+
+    /**
+     * Creates the event with the type tag
+     *
+     * @param typeTag The type tag: the dxFeed C-API event id of the event type (EventTraits<T>::cApiEventId) or
+     * UNKNOWN_TYPE_TAG
+     */
+    explicit Event(unsigned typeTag) noexcept : typeTag_{typeTag} {}
+
+  public:
+    /// Returns the type tag: the dxFeed C-API event id of the event type or UNKNOWN_TYPE_TAG
+    unsigned getTypeTag() const noexcept { return typeTag_; }
+
+    /**
+     * Converts the event to the type T. For the (final) types that have the EventTraits specialization the tag of the
+     * event is checked, and the pointer is converted statically, without RTTI. For other types it is sharedAs<T>().
+     *
+     * The event that is held by handles (Event::Handle) is converted too: the result holds a new handle of the event
+     * (toSharedPtr() allocates a control block), the free function fastAs<T>(handle) converts it without allocation.
+     *
+     * @tparam T The event type
+     * @return The pointer to the event or an empty pointer if the event is not T
+     */
+    template <typename T> std::shared_ptr<T> fastAs() {
+        return fastAs<T>(std::integral_constant<bool, EventTraits<T>::isSpecialized>{});
+    }
+
+    /**
+     * Converts the pointer to the event to the type T, as fastAs<T>() does (the event handles are converted by the
+     * free function fastAs<T>(handle))
+     *
+     * @tparam T The event type
+     * @return The pointer to the event or nullptr if the event is not T
+     */
+    template <typename T> T *fastCast() noexcept {
+        return fastCast<T>(std::integral_constant<bool, EventTraits<T>::isSpecialized>{});
+    }
+
     /// Returns event symbol that identifies this event type
     virtual const std::string &getEventSymbol() const = 0;
 
     /// Changes event symbol that identifies this event type
     virtual void setEventSymbol(const std::string &) = 0;
 
+    /**
+     * Returns the id of the event symbol in the SymbolTable. The events that are received from the C-API always have
+     * a valid id: the events of the symbols that can't be interned (the table is full) are not delivered.
+     *
+     * @return The id of the event symbol
+     * @throws SymbolTableOverflowError if the symbol has to be interned and the SymbolTable is full
+     */
+    virtual SymbolTable::IdType getEventSymbolId() const {
+        return SymbolTable::getInstance().intern(getEventSymbol());
+    }
+
     /// Returns time when event was created or zero when time is not available.
     /// Events that are coming from a network connections do not have an embedded event time information and
     /// this method will return zero for them, meaning that event was received just now.
@@ -83,35 +186,69 @@ struct Event : public SharedEntity {
     virtual void setEventTime(std::uint64_t) = 0;
 };
 
+/**
+ * Converts the event handle to the type T, as Event::fastAs does: by the type tag for the types that have the
+ * EventTraits specialization, by dynamic_cast for other types.
+ *
+ * @tparam T The event type
+ * @tparam RefCount The reference counting policy of the handle
+ * @param event The event handle
+ * @return The handle of the event or an empty handle if the event is not T
+ */
+template <typename T, typename RefCount> IntrusivePtr<T, RefCount> fastAs(const IntrusivePtr<Event, RefCount> &event) {
+    if (!event || event->template fastCast<T>() == nullptr) {
+        return {};
+    }
+
+    return event.template staticCast<T>();
+}
+
 /**
  * Base class for all market events. All market events are plain java objects that
  * extend this class. Market event classes are simple beans with setter and getter methods for their
- * properties and minimal business logic. All market events have #eventSymbol_ property that is
+ * properties and minimal business logic. All market events have #eventSymbolId_ property that is
  * defined by this class.
  */
 struct MarketEvent : public Event {
     /// The alias to a type of shared pointer to the MarketEvent object
     using Ptr = std::shared_ptr<MarketEvent>;
 
+    /// The alias to a type of intrusive handle to the MarketEvent object
+    using Handle = IntrusivePtr<MarketEvent>;
+
   private:
-    std::string eventSymbol_{};
+    SymbolTable::IdType eventSymbolId_{SymbolTable::EMPTY_SYMBOL_ID};
     std::uint64_t eventTime_{};
 
   protected:
     /**
      *
      * @param eventSymbol
+     * @param typeTag The type tag of the event (see Event::getTypeTag)
      */
-    explicit MarketEvent(std::string eventSymbol) : eventSymbol_{std::move(eventSymbol)} {}
+    explicit MarketEvent(const std::string &eventSymbol, unsigned typeTag = UNKNOWN_TYPE_TAG)
+        : Event(typeTag), eventSymbolId_{SymbolTable::getInstance().intern(eventSymbol)} {}
+
+    /**
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param typeTag The type tag of the event (see Event::getTypeTag)
+     */
+    explicit MarketEvent(SymbolTable::IdType eventSymbolId, unsigned typeTag = UNKNOWN_TYPE_TAG)
+        : Event(typeTag), eventSymbolId_{eventSymbolId} {}
 
   public:
     /// Returns symbol of this event.
-    const std::string &getEventSymbol() const override { return eventSymbol_; }
+    const std::string &getEventSymbol() const override { return SymbolTable::getInstance().getSymbol(eventSymbolId_); }
     /**
      *
      * @param eventSymbol
      */
-    void setEventSymbol(const std::string &eventSymbol) override { eventSymbol_ = eventSymbol; }
+    void setEventSymbol(const std::string &eventSymbol) override {
+        eventSymbolId_ = SymbolTable::getInstance().intern(eventSymbol);
+    }
+    /// Returns the id of the event symbol in the SymbolTable
+    SymbolTable::IdType getEventSymbolId() const override { return eventSymbolId_; }
     ///
     std::uint64_t getEventTime() const override { return eventTime_; }
     /**
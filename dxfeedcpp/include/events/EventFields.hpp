@@ -0,0 +1,489 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common/DXFCppConfig.hpp"
+
+#include "utils/Utils.hpp"
+
+#include "Candle.hpp"
+#include "Configuration.hpp"
+#include "Greeks.hpp"
+#include "Order.hpp"
+#include "Profile.hpp"
+#include "Quote.hpp"
+#include "Series.hpp"
+#include "Summary.hpp"
+#include "TheoPrice.hpp"
+#include "TimeAndSale.hpp"
+#include "Trade.hpp"
+#include "Underlying.hpp"
+
+namespace dxfcpp {
+
+/// The kind of the event field: it defines how the serializers format the value of the field
+enum class FieldKind : std::uint8_t {
+    /// An integral value (or a dxFeed C-API enum value)
+    INTEGER,
+
+    /// A floating point value
+    DOUBLE,
+
+    /// A boolean value
+    BOOLEAN,
+
+    /// A character (for example, an exchange code)
+    CHAR,
+
+    /// A string (for example, an event symbol)
+    STRING,
+
+    /// A time in milliseconds since Unix epoch
+    TIME,
+
+    /// A day identifier: the number of days since Unix epoch
+    DAY_ID,
+
+    /// An integral value that is formatted as hex (for example, raw flags)
+    HEX,
+
+    /// An enum wrapper with the name (OrderScope, PriceType, Direction)
+    ENUM,
+
+    /// An EventFlagsMask
+    FLAGS,
+};
+
+/**
+ * The compile-time descriptor of an event field: the name, the pointer to the getter and the kind of the field.
+ *
+ * @tparam C The class that declares the getter (the event type or its base)
+ * @tparam R The type of the value of the field
+ */
+template <typename C, typename R> struct Field final {
+    /// The type of the value of the field
+    using ValueType = R;
+
+    /// The name of the field
+    StringView name;
+
+    /// The pointer to the getter of the field
+    R (C::*getter)() const;
+
+    /// The kind of the field
+    FieldKind kind;
+
+    /**
+     * Returns the value of the field of the event
+     *
+     * @tparam E The event type (C or its subclass)
+     * @param event The event
+     * @return The value of the field
+     */
+    template <typename E> R get(const E &event) const { return (event.*getter)(); }
+};
+
+/**
+ * Creates the descriptor of an event field
+ *
+ * @tparam C The class that declares the getter
+ * @tparam R The type of the value of the field
+ * @param name The name of the field
+ * @param getter The pointer to the getter
+ * @param kind The kind of the field
+ * @return The descriptor
+ */
+template <typename C, typename R>
+DXFCPP_CONSTEXPR Field<C, R> makeField(StringView name, R (C::*getter)() const, FieldKind kind) {
+    return Field<C, R>{name, getter, kind};
+}
+
+/// The compile-time list of the heterogeneous field descriptors
+template <typename... Fs> struct FieldList;
+
+template <> struct FieldList<> final {
+    /// The number of the fields
+    static DXFCPP_USE_CONSTEXPR std::size_t SIZE = 0;
+
+    DXFCPP_CONSTEXPR FieldList() {}
+
+    /// Calls the visitor for each field descriptor in the order of the list
+    template <typename Visitor> void forEach(Visitor &) const {}
+};
+
+template <typename F, typename... Fs> struct FieldList<F, Fs...> final {
+    static DXFCPP_USE_CONSTEXPR std::size_t SIZE = 1 + sizeof...(Fs);
+
+    /// The first field
+    F head;
+
+    /// The rest of the fields
+    FieldList<Fs...> tail;
+
+    DXFCPP_CONSTEXPR FieldList(F first, Fs... rest) : head(first), tail(rest...) {}
+
+    template <typename Visitor> void forEach(Visitor &visitor) const {
+        visitor(head);
+        tail.forEach(visitor);
+    }
+};
+
+/**
+ * Creates the list of the field descriptors
+ *
+ * @tparam Fs The types of the descriptors
+ * @param fields The descriptors
+ * @return The list
+ */
+template <typename... Fs> DXFCPP_CONSTEXPR FieldList<Fs...> makeFieldList(Fs... fields) {
+    return FieldList<Fs...>(fields...);
+}
+
+/**
+ * The compile-time reflection of the event type: the name of the type and the field descriptors that forEach() passes
+ * to the visitor in the order of serialization. The descriptors are built by the call (there are no static tables), so
+ * the reflection does not depend on DXFCPP_USE_CONSTEXPR being constexpr.
+ *
+ * @tparam E The event type
+ */
+template <typename E> struct EventFields {
+    /// The specialization flag's stub for the types without the reflection
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = false;
+};
+
+template <> struct EventFields<Quote> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "Quote"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &Quote::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &Quote::getEventTime, FieldKind::TIME),
+                      makeField("time", &Quote::getTime, FieldKind::TIME),
+                      makeField("timeNanoPart", &Quote::getTimeNanoPart, FieldKind::INTEGER),
+                      makeField("sequence", &Quote::getSequence, FieldKind::INTEGER),
+                      makeField("bidTime", &Quote::getBidTime, FieldKind::TIME),
+                      makeField("bidExchange", &Quote::getBidExchangeCode, FieldKind::CHAR),
+                      makeField("bidPrice", &Quote::getBidPrice, FieldKind::DOUBLE),
+                      makeField("bidSize", &Quote::getBidSize, FieldKind::DOUBLE),
+                      makeField("askTime", &Quote::getAskTime, FieldKind::TIME),
+                      makeField("askExchange", &Quote::getAskExchangeCode, FieldKind::CHAR),
+                      makeField("askPrice", &Quote::getAskPrice, FieldKind::DOUBLE),
+                      makeField("askSize", &Quote::getAskSize, FieldKind::DOUBLE),
+                      makeField("scope", &Quote::getScope, FieldKind::ENUM)).forEach(visitor);
+    }
+};
+
+template <> struct EventFields<Candle> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "Candle"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &Candle::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &Candle::getEventTime, FieldKind::TIME),
+                      makeField("eventFlags", &Candle::getEventFlags, FieldKind::FLAGS),
+                      makeField("index", &Candle::getIndex, FieldKind::INTEGER),
+                      makeField("time", &Candle::getTime, FieldKind::TIME),
+                      makeField("sequence", &Candle::getSequence, FieldKind::INTEGER),
+                      makeField("count", &Candle::getCount, FieldKind::INTEGER),
+                      makeField("open", &Candle::getOpen, FieldKind::DOUBLE),
+                      makeField("high", &Candle::getHigh, FieldKind::DOUBLE),
+                      makeField("low", &Candle::getLow, FieldKind::DOUBLE),
+                      makeField("close", &Candle::getClose, FieldKind::DOUBLE),
+                      makeField("volume", &Candle::getVolume, FieldKind::DOUBLE),
+                      makeField("vwap", &Candle::getVWAP, FieldKind::DOUBLE),
+                      makeField("bidVolume", &Candle::getBidVolume, FieldKind::DOUBLE),
+                      makeField("askVolume", &Candle::getAskVolume, FieldKind::DOUBLE),
+                      makeField("impVolatility", &Candle::getImpVolatility, FieldKind::DOUBLE),
+                      makeField("openInterest", &Candle::getOpenInterest, FieldKind::DOUBLE)).forEach(visitor);
+    }
+};
+
+/// The reflection of the fields that are common for Trade and TradeETH
+template <typename E> struct TradeFields {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &TradeBase::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &TradeBase::getEventTime, FieldKind::TIME),
+                      makeField("time", &TradeBase::getTime, FieldKind::TIME),
+                      makeField("timeNanoPart", &TradeBase::getTimeNanoPart, FieldKind::INTEGER),
+                      makeField("sequence", &TradeBase::getSequence, FieldKind::INTEGER),
+                      makeField("exchange", &TradeBase::getExchangeCode, FieldKind::CHAR),
+                      makeField("price", &TradeBase::getPrice, FieldKind::DOUBLE),
+                      makeField("change", &TradeBase::getChange, FieldKind::DOUBLE),
+                      makeField("size", &TradeBase::getSize, FieldKind::DOUBLE),
+                      makeField("day", &TradeBase::getDayId, FieldKind::DAY_ID),
+                      makeField("dayVolume", &TradeBase::getDayVolume, FieldKind::DOUBLE),
+                      makeField("dayTurnover", &TradeBase::getDayTurnover, FieldKind::DOUBLE),
+                      makeField("direction", &TradeBase::getDirection, FieldKind::ENUM),
+                      makeField("ETH", &TradeBase::isExtendedTradingHours, FieldKind::BOOLEAN),
+                      makeField("scope", &TradeBase::getScope, FieldKind::ENUM),
+                      makeField("rawFlags", &TradeBase::getFlags, FieldKind::HEX)).forEach(visitor);
+    }
+};
+
+template <> struct EventFields<Trade> : TradeFields<Trade> {
+    static DXFCPP_CONSTEXPR StringView getName() { return "Trade"; }
+};
+
+template <> struct EventFields<TradeETH> : TradeFields<TradeETH> {
+    static DXFCPP_CONSTEXPR StringView getName() { return "TradeETH"; }
+};
+
+template <> struct EventFields<Summary> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "Summary"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &Summary::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &Summary::getEventTime, FieldKind::TIME),
+                      makeField("day", &Summary::getDayId, FieldKind::DAY_ID),
+                      makeField("dayOpen", &Summary::getDayOpenPrice, FieldKind::DOUBLE),
+                      makeField("dayHigh", &Summary::getDayHighPrice, FieldKind::DOUBLE),
+                      makeField("dayLow", &Summary::getDayLowPrice, FieldKind::DOUBLE),
+                      makeField("dayClose", &Summary::getDayClosePrice, FieldKind::DOUBLE),
+                      makeField("dayCloseType", &Summary::getDayClosePriceType, FieldKind::ENUM),
+                      makeField("prevDay", &Summary::getPrevDayId, FieldKind::DAY_ID),
+                      makeField("prevDayClose", &Summary::getPrevDayClosePrice, FieldKind::DOUBLE),
+                      makeField("prevDayCloseType", &Summary::getPrevDayClosePriceType, FieldKind::ENUM),
+                      makeField("prevDayVolume", &Summary::getPrevDayVolume, FieldKind::DOUBLE),
+                      makeField("openInterest", &Summary::getOpenInterest, FieldKind::DOUBLE),
+                      makeField("rawFlags", &Summary::getRawFlags, FieldKind::HEX),
+                      makeField("exchange", &Summary::getExchangeCode, FieldKind::CHAR),
+                      makeField("scope", &Summary::getScope, FieldKind::ENUM)).forEach(visitor);
+    }
+};
+
+template <> struct EventFields<Profile> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "Profile"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &Profile::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &Profile::getEventTime, FieldKind::TIME),
+                      makeField("description", &Profile::getDescription, FieldKind::STRING),
+                      makeField("tradingStatus", &Profile::getTradingStatus, FieldKind::INTEGER),
+                      makeField("statusReason", &Profile::getStatusReason, FieldKind::STRING),
+                      makeField("haltStartTime", &Profile::getHaltStartTime, FieldKind::TIME),
+                      makeField("haltEndTime", &Profile::getHaltEndTime, FieldKind::TIME),
+                      makeField("highLimitPrice", &Profile::getHighLimitPrice, FieldKind::DOUBLE),
+                      makeField("lowLimitPrice", &Profile::getLowLimitPrice, FieldKind::DOUBLE),
+                      makeField("high52WeekPrice", &Profile::getHigh52WeekPrice, FieldKind::DOUBLE),
+                      makeField("low52WeekPrice", &Profile::getLow52WeekPrice, FieldKind::DOUBLE),
+                      makeField("beta", &Profile::getBeta, FieldKind::DOUBLE),
+                      makeField("eps", &Profile::getEps, FieldKind::DOUBLE),
+                      makeField("divFreq", &Profile::getDivFreq, FieldKind::DOUBLE),
+                      makeField("exdDivAmount", &Profile::getExdDivAmount, FieldKind::DOUBLE),
+                      makeField("exdDivDate", &Profile::getExdDivDate, FieldKind::DAY_ID),
+                      makeField("shares", &Profile::getShares, FieldKind::DOUBLE),
+                      makeField("freeFloat", &Profile::getFreeFloat, FieldKind::DOUBLE),
+                      makeField("ssr", &Profile::getShortSaleRestriction, FieldKind::INTEGER),
+                      makeField("rawFlags", &Profile::getRawFlags, FieldKind::HEX)).forEach(visitor);
+    }
+};
+
+/// The reflection of the fields of OrderBase that are common for Order and SpreadOrder
+template <typename E> struct OrderFields {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &OrderBase::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &OrderBase::getEventTime, FieldKind::TIME),
+                      makeField("source", &OrderBase::getSourceName, FieldKind::STRING),
+                      makeField("eventFlags", &OrderBase::getEventFlags, FieldKind::FLAGS),
+                      makeField("index", &OrderBase::getIndex, FieldKind::HEX),
+                      makeField("time", &OrderBase::getTime, FieldKind::TIME),
+                      makeField("sequence", &OrderBase::getSequence, FieldKind::INTEGER),
+                      makeField("timeNanoPart", &OrderBase::getTimeNanoPart, FieldKind::INTEGER),
+                      makeField("action", &OrderBase::getAction, FieldKind::INTEGER),
+                      makeField("actionTime", &OrderBase::getActionTime, FieldKind::TIME),
+                      makeField("orderId", &OrderBase::getOrderId, FieldKind::INTEGER),
+                      makeField("auxOrderId", &OrderBase::getAuxOrderId, FieldKind::INTEGER),
+                      makeField("price", &OrderBase::getPrice, FieldKind::DOUBLE),
+                      makeField("size", &OrderBase::getSize, FieldKind::DOUBLE),
+                      makeField("executedSize", &OrderBase::getExecutedSize, FieldKind::DOUBLE),
+                      makeField("count", &OrderBase::getCount, FieldKind::INTEGER),
+                      makeField("exchange", &OrderBase::getExchangeCode, FieldKind::CHAR),
+                      makeField("side", &OrderBase::getOrderSide, FieldKind::INTEGER),
+                      makeField("scope", &OrderBase::getScope, FieldKind::ENUM),
+                      makeField("tradeId", &OrderBase::getTradeId, FieldKind::INTEGER),
+                      makeField("tradePrice", &OrderBase::getTradePrice, FieldKind::DOUBLE),
+                      makeField("tradeSize", &OrderBase::getTradeSize, FieldKind::DOUBLE)).forEach(visitor);
+    }
+};
+
+template <> struct EventFields<Order> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "Order"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        OrderFields<Order>::forEach(visitor);
+        visitor(makeField("marketMaker", &Order::getMarketMaker, FieldKind::STRING));
+    }
+};
+
+template <> struct EventFields<SpreadOrder> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "SpreadOrder"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        OrderFields<SpreadOrder>::forEach(visitor);
+        visitor(makeField("spreadSymbol", &SpreadOrder::getSpreadSymbol, FieldKind::STRING));
+    }
+};
+
+template <> struct EventFields<TimeAndSale> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "TimeAndSale"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &TimeAndSale::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &TimeAndSale::getEventTime, FieldKind::TIME),
+                      makeField("eventFlags", &TimeAndSale::getEventFlags, FieldKind::FLAGS),
+                      makeField("time", &TimeAndSale::getTime, FieldKind::TIME),
+                      makeField("index", &TimeAndSale::getIndex, FieldKind::HEX),
+                      makeField("exchange", &TimeAndSale::getExchangeCode, FieldKind::CHAR),
+                      makeField("price", &TimeAndSale::getPrice, FieldKind::DOUBLE),
+                      makeField("size", &TimeAndSale::getSize, FieldKind::DOUBLE),
+                      makeField("bid", &TimeAndSale::getBidPrice, FieldKind::DOUBLE),
+                      makeField("ask", &TimeAndSale::getAskPrice, FieldKind::DOUBLE),
+                      makeField("ESC", &TimeAndSale::getExchangeSaleConditions, FieldKind::STRING),
+                      makeField("TTE", &TimeAndSale::getTradeThroughExempt, FieldKind::CHAR),
+                      makeField("side", &TimeAndSale::getAggressorSide, FieldKind::INTEGER),
+                      makeField("spread", &TimeAndSale::isSpreadLeg, FieldKind::BOOLEAN),
+                      makeField("ETH", &TimeAndSale::isExtendedTradingHours, FieldKind::BOOLEAN),
+                      makeField("validTick", &TimeAndSale::isValidTick, FieldKind::BOOLEAN),
+                      makeField("type", &TimeAndSale::getType, FieldKind::INTEGER),
+                      makeField("buyer", &TimeAndSale::getBuyer, FieldKind::STRING),
+                      makeField("seller", &TimeAndSale::getSeller, FieldKind::STRING),
+                      makeField("rawFlags", &TimeAndSale::getRawFlags, FieldKind::HEX),
+                      makeField("scope", &TimeAndSale::getScope, FieldKind::ENUM)).forEach(visitor);
+    }
+};
+
+template <> struct EventFields<Greeks> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "Greeks"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &Greeks::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &Greeks::getEventTime, FieldKind::TIME),
+                      makeField("eventFlags", &Greeks::getEventFlags, FieldKind::FLAGS),
+                      makeField("time", &Greeks::getTime, FieldKind::TIME),
+                      makeField("index", &Greeks::getIndex, FieldKind::HEX),
+                      makeField("price", &Greeks::getPrice, FieldKind::DOUBLE),
+                      makeField("volatility", &Greeks::getVolatility, FieldKind::DOUBLE),
+                      makeField("delta", &Greeks::getDelta, FieldKind::DOUBLE),
+                      makeField("gamma", &Greeks::getGamma, FieldKind::DOUBLE),
+                      makeField("theta", &Greeks::getTheta, FieldKind::DOUBLE),
+                      makeField("rho", &Greeks::getRho, FieldKind::DOUBLE),
+                      makeField("vega", &Greeks::getVega, FieldKind::DOUBLE)).forEach(visitor);
+    }
+};
+
+template <> struct EventFields<TheoPrice> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "TheoPrice"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &TheoPrice::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &TheoPrice::getEventTime, FieldKind::TIME),
+                      makeField("eventFlags", &TheoPrice::getEventFlags, FieldKind::FLAGS),
+                      makeField("time", &TheoPrice::getTime, FieldKind::TIME),
+                      makeField("index", &TheoPrice::getIndex, FieldKind::HEX),
+                      makeField("price", &TheoPrice::getPrice, FieldKind::DOUBLE),
+                      makeField("underlyingPrice", &TheoPrice::getUnderlyingPrice, FieldKind::DOUBLE),
+                      makeField("delta", &TheoPrice::getDelta, FieldKind::DOUBLE),
+                      makeField("gamma", &TheoPrice::getGamma, FieldKind::DOUBLE),
+                      makeField("dividend", &TheoPrice::getDividend, FieldKind::DOUBLE),
+                      makeField("interest", &TheoPrice::getInterest, FieldKind::DOUBLE)).forEach(visitor);
+    }
+};
+
+template <> struct EventFields<Underlying> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "Underlying"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &Underlying::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &Underlying::getEventTime, FieldKind::TIME),
+                      makeField("eventFlags", &Underlying::getEventFlags, FieldKind::FLAGS),
+                      makeField("time", &Underlying::getTime, FieldKind::TIME),
+                      makeField("index", &Underlying::getIndex, FieldKind::HEX),
+                      makeField("volatility", &Underlying::getVolatility, FieldKind::DOUBLE),
+                      makeField("frontVolatility", &Underlying::getFrontVolatility, FieldKind::DOUBLE),
+                      makeField("backVolatility", &Underlying::getBackVolatility, FieldKind::DOUBLE),
+                      makeField("callVolume", &Underlying::getCallVolume, FieldKind::DOUBLE),
+                      makeField("putVolume", &Underlying::getPutVolume, FieldKind::DOUBLE),
+                      makeField("optionVolume", &Underlying::getOptionVolume, FieldKind::DOUBLE),
+                      makeField("putCallRatio", &Underlying::getPutCallRatio, FieldKind::DOUBLE)).forEach(visitor);
+    }
+};
+
+template <> struct EventFields<Series> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "Series"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &Series::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &Series::getEventTime, FieldKind::TIME),
+                      makeField("eventFlags", &Series::getEventFlags, FieldKind::FLAGS),
+                      makeField("index", &Series::getIndex, FieldKind::HEX),
+                      makeField("time", &Series::getTime, FieldKind::TIME),
+                      makeField("sequence", &Series::getSequence, FieldKind::INTEGER),
+                      makeField("expiration", &Series::getExpiration, FieldKind::DAY_ID),
+                      makeField("volatility", &Series::getVolatility, FieldKind::DOUBLE),
+                      makeField("callVolume", &Series::getCallVolume, FieldKind::DOUBLE),
+                      makeField("putVolume", &Series::getPutVolume, FieldKind::DOUBLE),
+                      makeField("optionVolume", &Series::getOptionVolume, FieldKind::DOUBLE),
+                      makeField("putCallRatio", &Series::getPutCallRatio, FieldKind::DOUBLE),
+                      makeField("forwardPrice", &Series::getForwardPrice, FieldKind::DOUBLE),
+                      makeField("dividend", &Series::getDividend, FieldKind::DOUBLE),
+                      makeField("interest", &Series::getInterest, FieldKind::DOUBLE)).forEach(visitor);
+    }
+};
+
+template <> struct EventFields<Configuration> {
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+
+    static DXFCPP_CONSTEXPR StringView getName() { return "Configuration"; }
+
+    /// Calls the visitor for each field descriptor in the order of serialization
+    template <typename Visitor> static void forEach(Visitor &visitor) {
+        makeFieldList(makeField("eventSymbol", &Configuration::getEventSymbol, FieldKind::STRING),
+                      makeField("eventTime", &Configuration::getEventTime, FieldKind::TIME),
+                      makeField("version", &Configuration::getVersion, FieldKind::INTEGER),
+                      makeField("attachment", &Configuration::getAttachment, FieldKind::STRING)).forEach(visitor);
+    }
+};
+
+} // namespace dxfcpp
@@ -6,8 +6,12 @@
 
 #include "common/DXFCppConfig.hpp"
 
+#include "utils/Utils.hpp"
+
+#include <cstdint>
 #include <numeric>
 #include <sstream>
+#include <string>
 #include <unordered_set>
 #include <utility>
 
@@ -17,12 +21,21 @@ class EventFlagsMask;
 
 /**
  * Wrapper over the dxf_event_flag enum
+ *
+ * It is a one-byte literal type: the wrapper holds the number of the bit of the flag and the names are in the
+ * static table (see OrderScope).
  */
 class EventFlag final {
-    unsigned flag_;
-    std::string name_;
+    // The number of the bit of the flag, INVALID_CODE for the invalid flag
+    std::uint8_t code_;
+
+    static DXFCPP_USE_CONSTEXPR std::uint8_t INVALID_CODE = 8;
 
-    EventFlag(unsigned flag, std::string name) : flag_{flag}, name_{std::move(name)} {}
+    template <typename = void> struct Names {
+        static const StringView VALUES[];
+    };
+
+    explicit DXFCPP_CONSTEXPR EventFlag(std::uint8_t code) noexcept : code_{code} {}
 
   public:
     ///
@@ -41,17 +54,17 @@ class EventFlag final {
     static const EventFlag REMOVE_SYMBOL;
 
     ///
-    explicit EventFlag() : flag_{unsigned(-1)}, name_{"INVALID"} {}
+    explicit DXFCPP_CONSTEXPR EventFlag() noexcept : code_{INVALID_CODE} {}
 
     ///
-    unsigned getFlag() const { return flag_; }
+    DXFCPP_CONSTEXPR unsigned getFlag() const noexcept { return code_ == INVALID_CODE ? unsigned(-1) : 1u << code_; }
 
     /**
      *
      * @param eventFlagsMask
      * @return
      */
-    bool in(unsigned eventFlagsMask) const { return (eventFlagsMask & flag_) != 0; }
+    DXFCPP_CONSTEXPR bool in(unsigned eventFlagsMask) const noexcept { return (eventFlagsMask & getFlag()) != 0; }
 
     /**
      *
@@ -59,25 +72,37 @@ class EventFlag final {
      * @param eventFlagsMask
      * @return
      */
-    template <typename EventFlagsMask> bool in(const EventFlagsMask &eventFlagsMask) const {
+    template <typename EventFlagsMask> DXFCPP_CONSTEXPR bool in(const EventFlagsMask &eventFlagsMask) const {
         return in(eventFlagsMask.getMask());
     }
 
     ///
-    const std::string &getName() const { return name_; }
+    StringView getName() const noexcept { return Names<>::VALUES[code_]; }
+
+    ///
+    std::string toString() const { return getName().toString(); }
+
+    ///
+    DXFCPP_CONSTEXPR bool operator==(const EventFlag &other) const noexcept { return code_ == other.code_; }
 
     ///
-    std::string toString() const { return name_; }
+    DXFCPP_CONSTEXPR bool operator!=(const EventFlag &other) const noexcept { return code_ != other.code_; }
 };
 
-const EventFlag EventFlag::TX_PENDING{0x01u, "TX_PENDING"};
-const EventFlag EventFlag::REMOVE_EVENT{0x02u, "REMOVE_EVENT"};
-const EventFlag EventFlag::SNAPSHOT_BEGIN{0x04u, "SNAPSHOT_BEGIN"};
-const EventFlag EventFlag::SNAPSHOT_END{0x08u, "SNAPSHOT_END"};
-const EventFlag EventFlag::SNAPSHOT_SNIP{0x10u, "SNAPSHOT_SNIP"};
+// 0x20 is reserved
+template <typename T>
+const StringView EventFlag::Names<T>::VALUES[] = {"TX_PENDING",    "REMOVE_EVENT",  "SNAPSHOT_BEGIN",
+                                                  "SNAPSHOT_END",  "SNAPSHOT_SNIP", "RESERVED",
+                                                  "SNAPSHOT_MODE", "REMOVE_SYMBOL", "INVALID"};
+
+DXFCPP_USE_CONSTEXPR EventFlag EventFlag::TX_PENDING{0};
+DXFCPP_USE_CONSTEXPR EventFlag EventFlag::REMOVE_EVENT{1};
+DXFCPP_USE_CONSTEXPR EventFlag EventFlag::SNAPSHOT_BEGIN{2};
+DXFCPP_USE_CONSTEXPR EventFlag EventFlag::SNAPSHOT_END{3};
+DXFCPP_USE_CONSTEXPR EventFlag EventFlag::SNAPSHOT_SNIP{4};
 // 0x20 is reserved. This flag will fit into 1-byte on the wire in QTP protocol
-const EventFlag EventFlag::SNAPSHOT_MODE{0x40u, "SNAPSHOT_MODE"};
-const EventFlag EventFlag::REMOVE_SYMBOL{0x80u, "REMOVE_SYMBOL"};
+DXFCPP_USE_CONSTEXPR EventFlag EventFlag::SNAPSHOT_MODE{6};
+DXFCPP_USE_CONSTEXPR EventFlag EventFlag::REMOVE_SYMBOL{7};
 
 } // namespace dxfcpp
 
@@ -0,0 +1,174 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+extern "C" {
+#include <DXFeed.h>
+#include <EventData.h>
+}
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "common/DXFCppConfig.hpp"
+
+#include "helpers/ObjectPool.hpp"
+#include "helpers/SymbolTable.hpp"
+
+#include "utils/Utils.hpp"
+
+#include "Candle.hpp"
+#include "Configuration.hpp"
+#include "Event.hpp"
+#include "EventTraits.hpp"
+#include "Greeks.hpp"
+#include "Order.hpp"
+#include "Profile.hpp"
+#include "Quote.hpp"
+#include "Series.hpp"
+#include "Summary.hpp"
+#include "TheoPrice.hpp"
+#include "TimeAndSale.hpp"
+#include "Trade.hpp"
+#include "Underlying.hpp"
+
+namespace dxfcpp {
+
+/**
+ * The compile-time registry of the dxFeed C++-API event types: the list of the types in the order of their dxFeed C-API
+ * event ids and the tables indexed by the id that are generated from the EventTraits specializations.
+ *
+ * A new event type is added by its EventTraits specialization and by its place in the #Types list.
+ */
+struct EventRegistry final {
+    /// The event types in the order of their dxFeed C-API event ids
+    using Types = meta::TypeList<Trade, Quote, Summary, Profile, Order, TimeAndSale, Candle, TradeETH, SpreadOrder,
+                                 Greeks, TheoPrice, Underlying, Series, Configuration>;
+
+    /// The number of the event types (dx_eid_count)
+    static DXFCPP_USE_CONSTEXPR std::size_t COUNT = static_cast<std::size_t>(dx_eid_count);
+
+  private:
+    // The order check is a type trait rather than a constexpr function, so it works without DXFCPP_CONSTEXPR too
+    template <std::size_t Id, typename List> struct AreOrderedById;
+
+    template <std::size_t Id>
+    struct AreOrderedById<Id, meta::TypeList<>> : std::integral_constant<bool, Id == COUNT> {};
+
+    template <std::size_t Id, typename E, typename... Es>
+    struct AreOrderedById<Id, meta::TypeList<E, Es...>>
+        : std::integral_constant<bool, EventTraits<E>::isSpecialized && EventTraits<E>::cApiEventId == Id &&
+                                           AreOrderedById<Id + 1, meta::TypeList<Es...>>::value> {};
+
+    template <typename Selector, typename... Es>
+    static typename Selector::FunctionType getFunction(std::size_t eventId, meta::TypeList<Es...>) {
+        static DXFCPP_USE_CONSTEXPR typename Selector::FunctionType table[] = {Selector::template get<Es>()...};
+
+        return eventId < sizeof...(Es) ? table[eventId] : nullptr;
+    }
+
+    template <typename E>
+    static Event::Ptr createEvent(SymbolTable::IdType symbolId, const dxf_event_data_t *data, std::size_t index) {
+        return ObjectPool<E>::makeShared(symbolId,
+                                         reinterpret_cast<const typename EventTraits<E>::CApiEventType *>(data)[index]);
+    }
+
+    struct CreateEventSelector {
+        using FunctionType = Event::Ptr (*)(SymbolTable::IdType, const dxf_event_data_t *, std::size_t);
+
+        template <typename E> static DXFCPP_CONSTEXPR FunctionType get() { return &EventRegistry::createEvent<E>; }
+    };
+
+    template <typename E> static std::uint64_t getIndex(const Event &event, std::true_type /* is indexed */) {
+        return static_cast<const E &>(event).getIndex();
+    }
+
+    template <typename E> static std::uint64_t getIndex(const Event &, std::false_type /* is indexed */) { return 0; }
+
+    template <typename E> static std::uint64_t getIndex(const Event &event) {
+        return getIndex<E>(event, std::integral_constant<bool, EventTraits<E>::isIndexedEvent>{});
+    }
+
+    struct IndexSelector {
+        using FunctionType = std::uint64_t (*)(const Event &);
+
+        template <typename E> static DXFCPP_CONSTEXPR FunctionType get() { return &EventRegistry::getIndex<E>; }
+    };
+
+  public:
+    /**
+     * Returns the dxFeed C-API event id of the event type that is passed to the C-API listeners (the mask with the one
+     * bit: the event id)
+     *
+     * @param eventType The dxFeed C-API event type (DXF_ET_*)
+     * @return The event id or COUNT for the invalid event type
+     */
+    static std::size_t getEventId(unsigned eventType) {
+#if defined(__GNUC__) || defined(__clang__)
+        return eventType == 0 ? static_cast<std::size_t>(dx_eid_count)
+                              : static_cast<std::size_t>(__builtin_ctz(eventType));
+#else
+        std::size_t result = 0;
+
+        for (; result < COUNT && (eventType & (1u << result)) == 0; result++) {
+        }
+
+        return result;
+#endif
+    }
+
+    /**
+     * Returns the function of the event type with the specified id from the table that is generated at compile time.
+     * The table is an array indexed by the event id, so the lookup is a single indexed load.
+     *
+     * The Selector provides the type of the functions (`FunctionType`) and the function of each event type
+     * (`template <typename E> static constexpr FunctionType get()`, it can return nullptr).
+     *
+     * @tparam Selector The selector of the functions
+     * @param eventId The dxFeed C-API event id
+     * @return The function or nullptr for the invalid id
+     */
+    template <typename Selector> static typename Selector::FunctionType getFunction(std::size_t eventId) {
+        return getFunction<Selector>(eventId, Types{});
+    }
+
+    /**
+     * Creates the event from the dxFeed C-API event data (in the ObjectPool of the event type)
+     *
+     * @param eventType The dxFeed C-API event type (DXF_ET_*)
+     * @param symbolId The id of the event symbol in the SymbolTable
+     * @param data The dxFeed C-API event data (the array of the events)
+     * @param index The index of the event in the array
+     * @return The new event or an empty pointer for the unknown event type
+     */
+    static Event::Ptr createEvent(unsigned eventType, SymbolTable::IdType symbolId, const dxf_event_data_t *data,
+                                  std::size_t index = 0) {
+        auto factory = getFunction<CreateEventSelector>(getEventId(eventType));
+
+        return factory != nullptr ? factory(symbolId, data, index) : Event::Ptr{};
+    }
+
+    /**
+     * Returns the index of the event (see Indexed::getIndex) by its type tag, without RTTI and virtual calls
+     *
+     * @param event The event
+     * @return The index of the event or 0 for the events that are not indexed or do not have the type tag of one of
+     * the #Types
+     */
+    static std::uint64_t getIndex(const Event &event) {
+        auto indexGetter = getFunction<IndexSelector>(event.getTypeTag());
+
+        return indexGetter != nullptr ? indexGetter(event) : 0;
+    }
+
+    /// True if the event types of the #Types list are ordered by the dxFeed C-API event ids
+    static DXFCPP_USE_CONSTEXPR bool IS_ORDERED_BY_ID = AreOrderedById<0, Types>::value;
+
+    static_assert(IS_ORDERED_BY_ID, "The event types must be ordered by the dxFeed C-API event ids");
+};
+
+} // namespace dxfcpp
@@ -0,0 +1,656 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+#include <clocale>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "common/DXFCppConfig.hpp"
+
+#include "utils/Utils.hpp"
+
+#include "Direction.hpp"
+#include "EventFields.hpp"
+#include "EventFlags.hpp"
+#include "EventTraits.hpp"
+#include "OrderScope.hpp"
+#include "PriceType.hpp"
+
+namespace dxfcpp {
+
+/**
+ * The writer to the caller-provided buffer. It never allocates: the characters that do not fit in the buffer are
+ * dropped, but they are still counted, so the caller can retry with the buffer of the required size. The result is not
+ * NUL-terminated.
+ */
+class BufferWriter final {
+    char *data_;
+    std::size_t capacity_;
+    std::size_t size_{};
+
+  public:
+    /**
+     * Creates the writer to the buffer
+     *
+     * @param data The buffer (can be nullptr if the capacity is zero)
+     * @param capacity The capacity of the buffer
+     */
+    BufferWriter(char *data, std::size_t capacity) noexcept : data_{data}, capacity_{capacity} {}
+
+    /// Returns the number of the characters that are written (or would be written to the buffer of enough capacity)
+    std::size_t getSize() const noexcept { return size_; }
+
+    /// Returns true if all the written characters fit in the buffer
+    bool isComplete() const noexcept { return size_ <= capacity_; }
+
+    ///
+    void write(char c) noexcept {
+        if (size_ < capacity_) {
+            data_[size_] = c;
+        }
+
+        size_++;
+    }
+
+    ///
+    void write(const char *data, std::size_t size) noexcept {
+        if (size_ < capacity_) {
+            std::memcpy(data_ + size_, data, size < capacity_ - size_ ? size : capacity_ - size_);
+        }
+
+        size_ += size;
+    }
+
+    ///
+    void write(const StringView &value) noexcept { write(value.data(), value.size()); }
+
+    /// Writes the value in decimal
+    void writeDecimal(std::uint64_t value) noexcept {
+        char digits[20];
+        std::size_t count = 0;
+
+        do {
+            digits[sizeof(digits) - ++count] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+
+        write(digits + sizeof(digits) - count, count);
+    }
+
+    /// Writes the value in decimal
+    void writeDecimal(std::int64_t value) noexcept {
+        if (value < 0) {
+            write('-');
+            writeDecimal(static_cast<std::uint64_t>(0) - static_cast<std::uint64_t>(value));
+        } else {
+            writeDecimal(static_cast<std::uint64_t>(value));
+        }
+    }
+
+    /// Writes the value in hex with the "0x" prefix (like string::toHex)
+    void writeHex(std::uint64_t value) noexcept {
+        static DXFCPP_USE_CONSTEXPR char HEX_DIGITS[] = "0123456789abcdef";
+        char digits[16];
+        std::size_t count = 0;
+
+        do {
+            digits[sizeof(digits) - ++count] = HEX_DIGITS[value & 0xf];
+            value >>= 4;
+        } while (value != 0);
+
+        write("0x", 2);
+        write(digits + sizeof(digits) - count, count);
+    }
+
+    /**
+     * Writes the value with 17 significant digits, so it is parsed back to the same double ("NaN" and "Infinity" for
+     * the special values). The decimal point is always '.', whatever the current C locale is.
+     */
+    void writeDouble(double value) noexcept {
+        if (std::isnan(value)) {
+            write("NaN", 3);
+        } else if (std::isinf(value)) {
+            if (value < 0) {
+                write('-');
+            }
+
+            write("Infinity", 8);
+        } else {
+            char buffer[32];
+            auto count = static_cast<std::size_t>(std::snprintf(buffer, sizeof(buffer), "%.17g", value));
+            const char *decimalPoint = std::localeconv()->decimal_point;
+            std::size_t decimalPointLength = std::strlen(decimalPoint);
+
+            if (decimalPointLength != 0 && std::strcmp(decimalPoint, ".") != 0) {
+                if (char *position = std::strstr(buffer, decimalPoint)) {
+                    *position = '.';
+                    std::memmove(position + 1, position + decimalPointLength,
+                                 count - static_cast<std::size_t>(position - buffer) - decimalPointLength + 1);
+                    count -= decimalPointLength - 1;
+                }
+            }
+
+            write(buffer, count);
+        }
+    }
+
+    /// Writes the yyyymmdd representation of the day id (like the toString implementations)
+    void writeDayId(std::int32_t dayId) noexcept {
+        writeDecimal(static_cast<std::int64_t>(day_util::getYearMonthDayByDayId(dayId)));
+    }
+
+    /// Writes the ISO-8601 UTC representation of the time in milliseconds (like DateTimeConverter::toISO)
+    void writeIsoTime(std::int64_t timestamp) noexcept {
+        static DXFCPP_USE_CONSTEXPR std::int64_t MILLIS_PER_DAY = 24LL * 60 * 60 * 1000;
+
+        std::int64_t dayId = timestamp >= 0 ? timestamp / MILLIS_PER_DAY : -((-timestamp - 1) / MILLIS_PER_DAY) - 1;
+        std::int64_t millisOfDay = timestamp - dayId * MILLIS_PER_DAY;
+        std::int32_t yyyymmdd = day_util::getYearMonthDayByDayId(static_cast<std::int32_t>(dayId));
+
+        if (yyyymmdd < 0) {
+            write('-');
+            yyyymmdd = -yyyymmdd;
+        }
+
+        writePadded(static_cast<std::uint64_t>(yyyymmdd / 10000), 4);
+        write('-');
+        writePadded(static_cast<std::uint64_t>(yyyymmdd / 100 % 100), 2);
+        write('-');
+        writePadded(static_cast<std::uint64_t>(yyyymmdd % 100), 2);
+        write('T');
+        writePadded(static_cast<std::uint64_t>(millisOfDay / 3600000), 2);
+        write(':');
+        writePadded(static_cast<std::uint64_t>(millisOfDay / 60000 % 60), 2);
+        write(':');
+        writePadded(static_cast<std::uint64_t>(millisOfDay / 1000 % 60), 2);
+        write('.');
+        writePadded(static_cast<std::uint64_t>(millisOfDay % 1000), 3);
+        write('Z');
+    }
+
+    /// Writes the bytes of the trivially copyable value in the native byte order
+    template <typename T> void writeRaw(const T &value) noexcept {
+        static_assert(std::is_trivially_copyable<T>::value, "The value must be trivially copyable");
+
+        char bytes[sizeof(T)];
+
+        std::memcpy(bytes, &value, sizeof(T));
+        write(bytes, sizeof(T));
+    }
+
+  private:
+    void writePadded(std::uint64_t value, std::size_t width) noexcept {
+        std::uint64_t limit = 1;
+
+        for (std::size_t i = 1; i < width; i++) {
+            limit *= 10;
+
+            if (value < limit) {
+                write('0');
+            }
+        }
+
+        writeDecimal(value);
+    }
+};
+
+/// The normalized value of an enum wrapper (OrderScope, PriceType, Direction): its name and its dxFeed C-API code
+struct EnumFieldValue final {
+    /// The name of the value
+    StringView name;
+
+    /// The dxFeed C-API code of the value
+    std::int32_t code;
+};
+
+/**
+ * The format of the event text representation that is close to the toString implementations:
+ * `Quote{eventSymbol=AAPL, eventTime=..., ...}`
+ */
+struct TextFormat final {
+    static void beginEvent(BufferWriter &writer, const StringView &typeName, unsigned) {
+        writer.write(typeName);
+        writer.write('{');
+    }
+
+    static void endEvent(BufferWriter &writer) { writer.write('}'); }
+
+    template <typename V>
+    static void writeField(BufferWriter &writer, std::size_t index, const StringView &name, FieldKind kind,
+                           const V &value) {
+        if (index != 0) {
+            writer.write(", ", 2);
+        }
+
+        writer.write(name);
+        writer.write('=');
+        writeValue(writer, kind, value);
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind, bool value) {
+        value ? writer.write("true", 4) : writer.write("false", 5);
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind, char value) {
+        if (value != '\0') {
+            writer.write(value);
+        }
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind, double value) { writer.writeDouble(value); }
+
+    static void writeValue(BufferWriter &writer, FieldKind kind, std::int64_t value) {
+        switch (kind) {
+        case FieldKind::TIME:
+            writer.writeIsoTime(value);
+            break;
+        case FieldKind::DAY_ID:
+            writer.writeDayId(static_cast<std::int32_t>(value));
+            break;
+        case FieldKind::HEX:
+        case FieldKind::FLAGS:
+            writer.writeHex(static_cast<std::uint64_t>(value));
+            break;
+        default:
+            writer.writeDecimal(value);
+        }
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind kind, std::uint64_t value) {
+        switch (kind) {
+        case FieldKind::TIME:
+            writer.writeIsoTime(static_cast<std::int64_t>(value));
+            break;
+        case FieldKind::HEX:
+        case FieldKind::FLAGS:
+            writer.writeHex(value);
+            break;
+        default:
+            writer.writeDecimal(value);
+        }
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind, const StringView &value) { writer.write(value); }
+
+    static void writeValue(BufferWriter &writer, FieldKind, const EnumFieldValue &value) { writer.write(value.name); }
+};
+
+/**
+ * The CSV (RFC 4180) format of the event: the comma-separated values in the order of the EventFields (without the type
+ * name, see EventSerializer::serializeHeader). The strings and the characters that contain the separators or the quotes
+ * are quoted.
+ */
+struct CsvFormat final {
+    static void beginEvent(BufferWriter &, const StringView &, unsigned) {}
+
+    static void endEvent(BufferWriter &) {}
+
+    static void beginHeader(BufferWriter &, const StringView &) {}
+
+    static void writeHeaderField(BufferWriter &writer, std::size_t index, const StringView &name) {
+        if (index != 0) {
+            writer.write(',');
+        }
+
+        writer.write(name);
+    }
+
+    static void endHeader(BufferWriter &) {}
+
+    template <typename V>
+    static void writeField(BufferWriter &writer, std::size_t index, const StringView &, FieldKind kind,
+                           const V &value) {
+        if (index != 0) {
+            writer.write(',');
+        }
+
+        writeValue(writer, kind, value);
+    }
+
+    template <typename V> static void writeValue(BufferWriter &writer, FieldKind kind, const V &value) {
+        TextFormat::writeValue(writer, kind, value);
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind kind, char value) {
+        char string[] = {value};
+
+        writeValue(writer, kind, StringView(string, value != '\0' ? 1 : 0));
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind, const StringView &value) {
+        bool needsQuotes = false;
+
+        for (std::size_t i = 0; i < value.size() && !needsQuotes; i++) {
+            needsQuotes = value[i] == ',' || value[i] == '"' || value[i] == '\n' || value[i] == '\r';
+        }
+
+        if (!needsQuotes) {
+            writer.write(value);
+
+            return;
+        }
+
+        writer.write('"');
+
+        for (std::size_t i = 0; i < value.size(); i++) {
+            if (value[i] == '"') {
+                writer.write('"');
+            }
+
+            writer.write(value[i]);
+        }
+
+        writer.write('"');
+    }
+};
+
+/**
+ * The JSON format of the event: `{"type":"Quote","eventSymbol":"AAPL",...}`. The times are the quoted ISO-8601 strings,
+ * the enums are their names, the flags and the hex fields are the quoted hex strings and NaN is `null`.
+ */
+struct JsonFormat final {
+    static void beginEvent(BufferWriter &writer, const StringView &typeName, unsigned) {
+        writer.write("{\"type\":", 8);
+        writeValue(writer, FieldKind::STRING, typeName);
+    }
+
+    static void endEvent(BufferWriter &writer) { writer.write('}'); }
+
+    template <typename V>
+    static void writeField(BufferWriter &writer, std::size_t, const StringView &name, FieldKind kind, const V &value) {
+        writer.write(',');
+        writeValue(writer, FieldKind::STRING, name);
+        writer.write(':');
+        writeValue(writer, kind, value);
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind kind, bool value) {
+        TextFormat::writeValue(writer, kind, value);
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind kind, char value) {
+        char string[] = {value};
+
+        writeValue(writer, kind, StringView(string, value != '\0' ? 1 : 0));
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind, double value) {
+        if (std::isfinite(value)) {
+            writer.writeDouble(value);
+        } else {
+            writer.write("null", 4);
+        }
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind kind, std::int64_t value) {
+        bool isQuoted = kind == FieldKind::TIME || kind == FieldKind::HEX || kind == FieldKind::FLAGS;
+
+        if (isQuoted) {
+            writer.write('"');
+        }
+
+        TextFormat::writeValue(writer, kind, value);
+
+        if (isQuoted) {
+            writer.write('"');
+        }
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind kind, std::uint64_t value) {
+        bool isQuoted = kind == FieldKind::TIME || kind == FieldKind::HEX || kind == FieldKind::FLAGS;
+
+        if (isQuoted) {
+            writer.write('"');
+        }
+
+        TextFormat::writeValue(writer, kind, value);
+
+        if (isQuoted) {
+            writer.write('"');
+        }
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind, const StringView &value) {
+        static DXFCPP_USE_CONSTEXPR char HEX_DIGITS[] = "0123456789abcdef";
+
+        writer.write('"');
+
+        for (std::size_t i = 0; i < value.size(); i++) {
+            char c = value[i];
+
+            switch (c) {
+            case '"':
+                writer.write("\\\"", 2);
+                break;
+            case '\\':
+                writer.write("\\\\", 2);
+                break;
+            case '\n':
+                writer.write("\\n", 2);
+                break;
+            case '\r':
+                writer.write("\\r", 2);
+                break;
+            case '\t':
+                writer.write("\\t", 2);
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    writer.write("\\u00", 4);
+                    writer.write(HEX_DIGITS[(c >> 4) & 0xf]);
+                    writer.write(HEX_DIGITS[c & 0xf]);
+                } else {
+                    writer.write(c);
+                }
+            }
+        }
+
+        writer.write('"');
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind kind, const EnumFieldValue &value) {
+        writeValue(writer, kind, value.name);
+    }
+};
+
+/**
+ * The compact binary format of the event: the dxFeed C-API event id (one byte) followed by the fields in the order of
+ * the EventFields. The values are written in the native byte order: booleans, characters and enum codes take one byte,
+ * flags take four bytes, integers and doubles take eight bytes, strings are the four-byte length followed by the UTF-8
+ * bytes. The enum codes outside 0..254 (for example, the UNKNOWN values) are written as UNKNOWN_ENUM_CODE (0xFF).
+ */
+struct BinaryFormat final {
+    /// The byte that is written for the enum codes that don't fit one byte
+    static DXFCPP_USE_CONSTEXPR std::uint8_t UNKNOWN_ENUM_CODE = 0xFF;
+
+    static void beginEvent(BufferWriter &writer, const StringView &, unsigned eventId) {
+        writer.write(static_cast<char>(eventId));
+    }
+
+    static void endEvent(BufferWriter &) {}
+
+    template <typename V>
+    static void writeField(BufferWriter &writer, std::size_t, const StringView &, FieldKind kind, const V &value) {
+        writeValue(writer, kind, value);
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind, bool value) { writer.write(value ? '\1' : '\0'); }
+
+    static void writeValue(BufferWriter &writer, FieldKind, char value) { writer.write(value); }
+
+    static void writeValue(BufferWriter &writer, FieldKind, double value) { writer.writeRaw(value); }
+
+    static void writeValue(BufferWriter &writer, FieldKind, std::int64_t value) { writer.writeRaw(value); }
+
+    static void writeValue(BufferWriter &writer, FieldKind kind, std::uint64_t value) {
+        if (kind == FieldKind::FLAGS) {
+            writer.writeRaw(static_cast<std::uint32_t>(value));
+        } else {
+            writer.writeRaw(value);
+        }
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind, const StringView &value) {
+        writer.writeRaw(static_cast<std::uint32_t>(value.size()));
+        writer.write(value);
+    }
+
+    static void writeValue(BufferWriter &writer, FieldKind, const EnumFieldValue &value) {
+        auto code = value.code >= 0 && value.code < UNKNOWN_ENUM_CODE ? static_cast<std::uint8_t>(value.code)
+                                                                       : std::uint8_t{UNKNOWN_ENUM_CODE};
+
+        writer.write(static_cast<char>(code));
+    }
+};
+
+/**
+ * The serializer of the events that is generated at compile time from the EventFields: the fields are written in one
+ * pass to the caller-provided buffer without the temporary strings and without the virtual calls of the event API.
+ *
+ * ```cpp
+ * char buffer[512];
+ * auto size = EventSerializer<JsonFormat>::serialize(quote, buffer, sizeof(buffer));
+ *
+ * if (size <= sizeof(buffer)) {
+ *     out.write(buffer, size);
+ * }
+ * ```
+ *
+ * @tparam Format The format (TextFormat, CsvFormat, JsonFormat or BinaryFormat)
+ */
+template <typename Format> struct EventSerializer final {
+  private:
+    static bool normalize(bool value) { return value; }
+
+    static char normalize(char value) { return value; }
+
+    static double normalize(double value) { return value; }
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, std::int64_t>::type
+    normalize(T value) {
+        return static_cast<std::int64_t>(value);
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, std::uint64_t>::type
+    normalize(T value) {
+        return static_cast<std::uint64_t>(value);
+    }
+
+    /// The dxFeed C-API enums (dxf_order_side_t, dxf_tns_type_t, etc.)
+    template <typename T>
+    static typename std::enable_if<std::is_enum<T>::value, std::int64_t>::type normalize(T value) {
+        return static_cast<std::int64_t>(value);
+    }
+
+    static StringView normalize(const std::string &value) { return {value.data(), value.size()}; }
+
+    static std::uint64_t normalize(const EventFlagsMask &value) { return value.getMask(); }
+
+    static EnumFieldValue normalize(const OrderScope &value) {
+        return {value.getName(), static_cast<std::int32_t>(value.getScope())};
+    }
+
+    static EnumFieldValue normalize(const PriceType &value) {
+        return {value.getName(), static_cast<std::int32_t>(value.getPriceType())};
+    }
+
+    static EnumFieldValue normalize(const Direction &value) {
+        return {value.getName(), static_cast<std::int32_t>(value.getDirection())};
+    }
+
+    template <typename E> struct FieldWriter {
+        const E &event;
+        BufferWriter &writer;
+        std::size_t index;
+
+        template <typename F> void operator()(const F &field) {
+            Format::writeField(writer, index++, field.name, field.kind, normalize(field.get(event)));
+        }
+    };
+
+    struct HeaderWriter {
+        BufferWriter &writer;
+        std::size_t index;
+
+        template <typename F> void operator()(const F &field) { Format::writeHeaderField(writer, index++, field.name); }
+    };
+
+  public:
+    /**
+     * Serializes the event to the buffer
+     *
+     * @tparam E The event type (it must have the EventFields specialization)
+     * @param event The event
+     * @param buffer The buffer (can be nullptr if the capacity is zero)
+     * @param capacity The capacity of the buffer
+     * @return The size of the result. If it is greater than the capacity then the result is truncated and the call
+     * should be repeated with the buffer of the returned size.
+     */
+    template <typename E> static std::size_t serialize(const E &event, char *buffer, std::size_t capacity) {
+        static_assert(EventFields<E>::isSpecialized, "The event type must have the EventFields specialization");
+
+        BufferWriter writer{buffer, capacity};
+        FieldWriter<E> fieldWriter{event, writer, 0};
+
+        Format::beginEvent(writer, EventFields<E>::getName(), EventTraits<E>::cApiEventId);
+        EventFields<E>::forEach(fieldWriter);
+        Format::endEvent(writer);
+
+        return writer.getSize();
+    }
+
+    /**
+     * Serializes the event to the string. The capacity of the string is reused, so the string is reallocated only when
+     * the result does not fit in it.
+     *
+     * @tparam E The event type (it must have the EventFields specialization)
+     * @param event The event
+     * @param result The string
+     */
+    template <typename E> static void serialize(const E &event, std::string &result) {
+        result.resize(result.capacity());
+
+        auto size = serialize(event, &result[0], result.size());
+
+        if (size > result.size()) {
+            result.resize(size);
+            serialize(event, &result[0], result.size());
+        }
+
+        result.resize(size);
+    }
+
+    /**
+     * Serializes the header (the names of the fields) of the event type to the buffer. It is supported by the formats
+     * with the header (CsvFormat).
+     *
+     * @tparam E The event type (it must have the EventFields specialization)
+     * @param buffer The buffer (can be nullptr if the capacity is zero)
+     * @param capacity The capacity of the buffer
+     * @return The size of the result (see #serialize)
+     */
+    template <typename E> static std::size_t serializeHeader(char *buffer, std::size_t capacity) {
+        static_assert(EventFields<E>::isSpecialized, "The event type must have the EventFields specialization");
+
+        BufferWriter writer{buffer, capacity};
+        HeaderWriter headerWriter{writer, 0};
+
+        Format::beginHeader(writer, EventFields<E>::getName());
+        EventFields<E>::forEach(headerWriter);
+        Format::endHeader(writer);
+
+        return writer.getSize();
+    }
+};
+
+} // namespace dxfcpp
@@ -58,6 +58,9 @@ struct EventTraitsBase {
 
     /// The only indexed (indexed, but not time series) event flag's stub for all non-event types
     static DXFCPP_USE_CONSTEXPR bool isOnlyIndexedEvent = false;
+
+    /// The non-owning view type stub for the types that have no view (see EventView)
+    using ViewType = void;
 };
 
 /**
@@ -97,7 +100,19 @@ struct Candle;
 struct Trade;
 struct TradeETH;
 struct Summary;
-// TODO: add events
+struct Profile;
+struct Order;
+struct SpreadOrder;
+struct TimeAndSale;
+struct Greeks;
+struct TheoPrice;
+struct Underlying;
+struct Series;
+struct Configuration;
+
+struct QuoteView;
+struct CandleView;
+template <typename E> struct BasicTradeView;
 
 /**
  * A typed helper that provides additional compile-time information about the Quote type
@@ -126,6 +141,9 @@ template <> struct EventTraits<Quote> : public EventTraitsBase {
 
     // The current event is a lasting event
     static DXFCPP_USE_CONSTEXPR bool isLastingEvent = true;
+
+    // The non-owning view of the current dxFeed C-API event type
+    using ViewType = QuoteView;
 };
 
 /**
@@ -158,6 +176,9 @@ template <> struct EventTraits<Candle> : public EventTraitsBase {
 
     // The current event is a time series event
     static DXFCPP_USE_CONSTEXPR bool isTimeSeriesEvent = true;
+
+    // The non-owning view of the current dxFeed C-API event type
+    using ViewType = CandleView;
 };
 
 /**
@@ -173,6 +194,7 @@ template <> struct EventTraits<Trade> : public EventTraitsBase {
     static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = DXF_ET_TRADE;
     static DXFCPP_USE_CONSTEXPR bool isMarketEvent = true;
     static DXFCPP_USE_CONSTEXPR bool isLastingEvent = true;
+    using ViewType = BasicTradeView<Trade>;
 };
 
 /**
@@ -188,6 +210,7 @@ template <> struct EventTraits<TradeETH> : public EventTraitsBase {
     static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = DXF_ET_TRADE_ETH;
     static DXFCPP_USE_CONSTEXPR bool isMarketEvent = true;
     static DXFCPP_USE_CONSTEXPR bool isLastingEvent = true;
+    using ViewType = BasicTradeView<TradeETH>;
 };
 
 /**
@@ -205,4 +228,169 @@ template <> struct EventTraits<Summary> : public EventTraitsBase {
     static DXFCPP_USE_CONSTEXPR bool isLastingEvent = true;
 };
 
+/**
+ * A typed helper that provides additional compile-time information about the Profile type
+ */
+template <> struct EventTraits<Profile> : public EventTraitsBase {
+    using Type = Profile;
+
+    static EventType getEventType() { return EventType::PROFILE; }
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+    using CApiEventType = dxf_profile_t;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventId = dx_eid_profile;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = DXF_ET_PROFILE;
+    static DXFCPP_USE_CONSTEXPR bool isMarketEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isLastingEvent = true;
+};
+
+/**
+ * A typed helper that provides additional compile-time information about the Order type
+ */
+template <> struct EventTraits<Order> : public EventTraitsBase {
+    using Type = Order;
+
+    static EventType getEventType() { return EventType::ORDER; }
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+    using CApiEventType = dxf_order_t;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventId = dx_eid_order;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = DXF_ET_ORDER;
+    static DXFCPP_USE_CONSTEXPR bool isMarketEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isIndexedEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isOnlyIndexedEvent = true;
+};
+
+/**
+ * A typed helper that provides additional compile-time information about the SpreadOrder type
+ */
+template <> struct EventTraits<SpreadOrder> : public EventTraitsBase {
+    using Type = SpreadOrder;
+
+    static EventType getEventType() { return EventType::SPREAD_ORDER; }
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+    using CApiEventType = dxf_order_t;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventId = dx_eid_spread_order;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = DXF_ET_SPREAD_ORDER;
+    static DXFCPP_USE_CONSTEXPR bool isMarketEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isIndexedEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isOnlyIndexedEvent = true;
+};
+
+/**
+ * A typed helper that provides additional compile-time information about the TimeAndSale type
+ */
+template <> struct EventTraits<TimeAndSale> : public EventTraitsBase {
+    using Type = TimeAndSale;
+
+    static EventType getEventType() { return EventType::TIME_AND_SALE; }
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+    using CApiEventType = dxf_time_and_sale_t;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventId = dx_eid_time_and_sale;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = DXF_ET_TIME_AND_SALE;
+    static DXFCPP_USE_CONSTEXPR bool isMarketEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isIndexedEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isTimeSeriesEvent = true;
+};
+
+/**
+ * A typed helper that provides additional compile-time information about the Greeks type
+ */
+template <> struct EventTraits<Greeks> : public EventTraitsBase {
+    using Type = Greeks;
+
+    static EventType getEventType() { return EventType::GREEKS; }
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+    using CApiEventType = dxf_greeks_t;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventId = dx_eid_greeks;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = DXF_ET_GREEKS;
+    static DXFCPP_USE_CONSTEXPR bool isMarketEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isIndexedEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isLastingEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isTimeSeriesEvent = true;
+};
+
+/**
+ * A typed helper that provides additional compile-time information about the TheoPrice type
+ */
+template <> struct EventTraits<TheoPrice> : public EventTraitsBase {
+    using Type = TheoPrice;
+
+    static EventType getEventType() { return EventType::THEO_PRICE; }
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+    using CApiEventType = dxf_theo_price_t;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventId = dx_eid_theo_price;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = DXF_ET_THEO_PRICE;
+    static DXFCPP_USE_CONSTEXPR bool isMarketEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isIndexedEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isLastingEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isTimeSeriesEvent = true;
+};
+
+/**
+ * A typed helper that provides additional compile-time information about the Underlying type
+ */
+template <> struct EventTraits<Underlying> : public EventTraitsBase {
+    using Type = Underlying;
+
+    static EventType getEventType() { return EventType::UNDERLYING; }
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+    using CApiEventType = dxf_underlying_t;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventId = dx_eid_underlying;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = DXF_ET_UNDERLYING;
+    static DXFCPP_USE_CONSTEXPR bool isMarketEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isIndexedEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isLastingEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isTimeSeriesEvent = true;
+};
+
+/**
+ * A typed helper that provides additional compile-time information about the Series type
+ */
+template <> struct EventTraits<Series> : public EventTraitsBase {
+    using Type = Series;
+
+    static EventType getEventType() { return EventType::SERIES; }
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+    using CApiEventType = dxf_series_t;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventId = dx_eid_series;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = DXF_ET_SERIES;
+    static DXFCPP_USE_CONSTEXPR bool isMarketEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isIndexedEvent = true;
+    static DXFCPP_USE_CONSTEXPR bool isOnlyIndexedEvent = true;
+};
+
+/**
+ * A typed helper that provides additional compile-time information about the Configuration type
+ */
+template <> struct EventTraits<Configuration> : public EventTraitsBase {
+    using Type = Configuration;
+
+    static EventType getEventType() { return EventType::CONFIGURATION; }
+    static DXFCPP_USE_CONSTEXPR bool isSpecialized = true;
+    using CApiEventType = dxf_configuration_t;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventId = dx_eid_configuration;
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = DXF_ET_CONFIGURATION;
+    static DXFCPP_USE_CONSTEXPR bool isLastingEvent = true;
+};
+
+/**
+ * A helper that provides compile-time information about a list of the dxFeed C++-API event types
+ *
+ * @tparam Es The event types
+ */
+template <typename... Es> struct EventTypesTraits {
+    /// The dxFeed C-API event mask of all the types
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask = 0u;
+
+    /// True if all the types are the specialized event types
+    static DXFCPP_USE_CONSTEXPR bool areSpecialized = true;
+};
+
+template <typename E, typename... Es> struct EventTypesTraits<E, Es...> {
+    static DXFCPP_USE_CONSTEXPR unsigned cApiEventMask =
+        EventTraits<E>::cApiEventMask | EventTypesTraits<Es...>::cApiEventMask;
+
+    static DXFCPP_USE_CONSTEXPR bool areSpecialized =
+        EventTraits<E>::isSpecialized && EventTypesTraits<Es...>::areSpecialized;
+};
+
 } // namespace dxfcpp
\ No newline at end of file
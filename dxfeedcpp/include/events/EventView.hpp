@@ -0,0 +1,79 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+extern "C" {
+#include <EventData.h>
+}
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "common/DXFCppConfig.hpp"
+
+#include "helpers/ObjectPool.hpp"
+#include "helpers/SymbolTable.hpp"
+
+namespace dxfcpp {
+
+/**
+ * The base class of the non-owning views of the dxFeed C-API events.
+ *
+ * A view wraps the C-API event data and the symbol for the duration of the listener call and reads the fields on
+ * demand, so it does not allocate and does not convert the fields that are not used. The view must not be kept after
+ * the call: materialize() creates the owning event.
+ *
+ * @tparam E The type of the owning event
+ * @tparam Data The type of the C-API event data
+ */
+template <typename E, typename Data> class EventView {
+    dxf_const_string_t eventSymbol_;
+    const Data *data_;
+    mutable SymbolTable::IdType eventSymbolId_{SymbolTable::EMPTY_SYMBOL_ID};
+    mutable bool isEventSymbolInterned_{false};
+
+  public:
+    /// The type of the owning event
+    using EventType = E;
+
+    /// The type of the C-API event data
+    using DataType = Data;
+
+    /**
+     * Creates the view
+     *
+     * @param eventSymbol The C-API event symbol
+     * @param data The C-API event data
+     */
+    EventView(dxf_const_string_t eventSymbol, const Data &data) noexcept : eventSymbol_{eventSymbol}, data_{&data} {}
+
+    /// Returns the C-API event symbol
+    dxf_const_string_t getRawEventSymbol() const { return eventSymbol_; }
+
+    /// Returns the id of the event symbol in the SymbolTable (the symbol is interned on the first call)
+    SymbolTable::IdType getEventSymbolId() const {
+        if (!isEventSymbolInterned_) {
+            eventSymbolId_ = SymbolTable::getInstance().intern(eventSymbol_);
+            isEventSymbolInterned_ = true;
+        }
+
+        return eventSymbolId_;
+    }
+
+    /// Returns symbol of this event.
+    const std::string &getEventSymbol() const { return SymbolTable::getInstance().getSymbol(getEventSymbolId()); }
+
+    /// Returns zero: the events that are coming from a network connections do not have an embedded event time
+    std::uint64_t getEventTime() const { return 0; }
+
+    /// Returns the C-API event data
+    const Data &getData() const { return *data_; }
+
+    /// Creates the owning event with the same fields
+    std::shared_ptr<E> materialize() const { return ObjectPool<E>::makeShared(getEventSymbolId(), *data_); }
+};
+
+} // namespace dxfcpp
@@ -8,6 +8,8 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <utility>
 
@@ -15,29 +17,123 @@ extern "C" {
 
 #include "converters/DateTimeConverter.hpp"
 
+#include "utils/Utils.hpp"
+
 #include "Event.hpp"
 #include "EventFlags.hpp"
 #include "EventTraits.hpp"
 
 namespace dxfcpp {
 
+/**
+ * Greeks event is a snapshot of the option price, Black-Scholes volatility and greeks.
+ * It represents the most recent information that is available about the corresponding values on the market at any
+ * given moment of time.
+ */
 struct Greeks final : public MarketEvent, public TimeSeries, public Lasting {
     /// The alias to a type of shared pointer to the Greeks object
     using Ptr = std::shared_ptr<Greeks>;
 
+    /// The alias to a type of intrusive handle to the Greeks object
+    using Handle = IntrusivePtr<Greeks>;
+
   private:
-    std::string eventSymbol_{};
     /// Transactional event flags
     EventFlagsMask eventFlags_{};
+    /// Unique per-symbol index of this event
+    std::uint64_t index_{};
+    /// Timestamp of this event in milliseconds
+    std::uint64_t time_{};
+    /// Option market price
+    double price_{std::numeric_limits<double>::quiet_NaN()};
+    /// Black-Scholes implied volatility of the option
+    double volatility_{std::numeric_limits<double>::quiet_NaN()};
+    /// Option delta
+    double delta_{std::numeric_limits<double>::quiet_NaN()};
+    /// Option gamma
+    double gamma_{std::numeric_limits<double>::quiet_NaN()};
+    /// Option theta
+    double theta_{std::numeric_limits<double>::quiet_NaN()};
+    /// Option rho
+    double rho_{std::numeric_limits<double>::quiet_NaN()};
+    /// Option vega
+    double vega_{std::numeric_limits<double>::quiet_NaN()};
 
   public:
-    std::string toString() const override { return std::string(); }
+    /**
+     * Creates new greeks event with the specified event symbol
+     *
+     * @param eventSymbol The event symbol
+     */
+    explicit Greeks(const std::string &eventSymbol) : MarketEvent(eventSymbol, EventTraits<Greeks>::cApiEventId) {}
+
+    /**
+     * Creates new greeks event with the specified event symbol and dxFeed C-API dxf_greeks_t
+     *
+     * @param eventSymbol The event symbol
+     * @param greeks The dxFeed C-API dxf_greeks_t object
+     */
+    Greeks(const std::string &eventSymbol, const dxf_greeks_t &greeks)
+        : Greeks(SymbolTable::getInstance().intern(eventSymbol), greeks) {}
+
+    /**
+     * Creates new greeks event with the specified event symbol id and dxFeed C-API dxf_greeks_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param greeks The dxFeed C-API dxf_greeks_t object
+     */
+    Greeks(SymbolTable::IdType eventSymbolId, const dxf_greeks_t &greeks)
+        : MarketEvent(eventSymbolId, EventTraits<Greeks>::cApiEventId), eventFlags_(greeks.event_flags),
+          index_{static_cast<std::uint64_t>(greeks.index)}, time_{static_cast<std::uint64_t>(greeks.time)},
+          price_{greeks.price}, volatility_{greeks.volatility}, delta_{greeks.delta}, gamma_{greeks.gamma},
+          theta_{greeks.theta}, rho_{greeks.rho}, vega_{greeks.vega} {}
+
+    Greeks &operator=(const Greeks &other) = delete;
+
+    Greeks &operator=(Greeks &&other) = delete;
+
     const IndexedEventSource &getSource() const override { return IndexedEventSource::DEFAULT; }
+
     const EventFlagsMask &getEventFlags() const override { return eventFlags_; }
-    void setEventFlags(const EventFlagsMask &mask) override {}
-    uint64_t getIndex() const override { return 0; }
-    void setIndex(std::uint64_t uint64) override {}
-    uint64_t getTime() const override { return 0; }
+
+    void setEventFlags(const EventFlagsMask &mask) override { eventFlags_ = mask; }
+
+    std::uint64_t getIndex() const override { return index_; }
+
+    void setIndex(std::uint64_t index) override { index_ = index; }
+
+    std::uint64_t getTime() const override { return time_; }
+
+    /// Returns option market price
+    double getPrice() const { return price_; }
+
+    /// Returns Black-Scholes implied volatility of the option
+    double getVolatility() const { return volatility_; }
+
+    /// Returns option delta
+    double getDelta() const { return delta_; }
+
+    /// Returns option gamma
+    double getGamma() const { return gamma_; }
+
+    /// Returns option theta
+    double getTheta() const { return theta_; }
+
+    /// Returns option rho
+    double getRho() const { return rho_; }
+
+    /// Returns option vega
+    double getVega() const { return vega_; }
+
+    /// Returns a string representation of the entity
+    std::string toString() const override {
+        return "Greeks{" + getEventSymbol() + ", eventTime=" + DateTimeConverter::toISO(getEventTime()) +
+            ", eventFlags=" + eventFlags_.toString() + ", time=" + DateTimeConverter::toISO(time_) +
+            ", index=" + string::toHex(index_) + ", price=" + std::to_string(price_) +
+            ", volatility=" + std::to_string(volatility_) + ", delta=" + std::to_string(delta_) +
+            ", gamma=" + std::to_string(gamma_) + ", theta=" + std::to_string(theta_) +
+            ", rho=" + std::to_string(rho_) + ", vega=" + std::to_string(vega_) + '}';
+    }
 };
 
-} // namespace dxfcpp
\ No newline at end of file
+} // namespace dxfcpp
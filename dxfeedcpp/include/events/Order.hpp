@@ -8,48 +8,303 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <utility>
 
 #include "common/DXFCppConfig.hpp"
 
 #include "converters/DateTimeConverter.hpp"
+#include "converters/StringConverter.hpp"
+
+#include "utils/Utils.hpp"
 
 #include "Event.hpp"
 #include "EventFlags.hpp"
 #include "EventTraits.hpp"
+#include "OrderScope.hpp"
 
 namespace dxfcpp {
 
+/**
+ * Base class for common fields of #Order and #SpreadOrder events.
+ * Order events represent a snapshot for a full available market depth for a symbol.
+ */
 struct OrderBase : public MarketEvent, public Indexed {
     /// The alias to a type of shared pointer to the OrderBase object
     using Ptr = std::shared_ptr<OrderBase>;
 
+    /// The alias to a type of intrusive handle to the OrderBase object
+    using Handle = IntrusivePtr<OrderBase>;
+
   private:
     /// Transactional event flags
     EventFlagsMask eventFlags_{};
+    /// Unique per-symbol index of this order
+    std::uint64_t index_{};
+    /// Time of this order
+    std::uint64_t time_{};
+    /// Sequence number of this order to distinguish orders that have the same #time_
+    std::int32_t sequence_{};
+    /// Microseconds and nanoseconds part of time of this order
+    std::int32_t timeNanoPart_{};
+    /// The action of this order (the C-API value)
+    dxf_order_action_t action_{};
+    /// Time of the last action of this order
+    std::uint64_t actionTime_{};
+    /// The order id
+    std::int64_t orderId_{};
+    /// The auxiliary order id
+    std::int64_t auxOrderId_{};
+    /// Price of this order
+    double price_{std::numeric_limits<double>::quiet_NaN()};
+    /// Size of this order
+    double size_{std::numeric_limits<double>::quiet_NaN()};
+    /// Executed size of this order
+    double executedSize_{std::numeric_limits<double>::quiet_NaN()};
+    /// The number of individual orders in this aggregate order
+    std::int64_t count_{};
+    /// The trade id
+    std::int64_t tradeId_{};
+    /// The trade price
+    double tradePrice_{std::numeric_limits<double>::quiet_NaN()};
+    /// The trade size
+    double tradeSize_{std::numeric_limits<double>::quiet_NaN()};
+    /// Exchange code of this order (the C-API value, it is converted by the getter)
+    dxf_char_t exchangeCode_{};
+    /// Side of this order (the C-API value)
+    dxf_order_side_t side_{};
+    /// Scope of this order (the C-API value, it is converted by the getter)
+    dxf_order_scope_t scope_{};
+    /// The source of this order (the C-API value, it is converted by the getter)
+    dxf_char_t source_[DXF_RECORD_SUFFIX_SIZE]{};
+
+  protected:
+    /**
+     * Creates new order with the specified event symbol
+     *
+     * @param eventSymbol The event symbol
+     * @param typeTag The type tag of the event (see Event::getTypeTag)
+     */
+    OrderBase(const std::string &eventSymbol, unsigned typeTag) : MarketEvent(eventSymbol, typeTag) {}
+
+    /**
+     * Creates new order with the specified event symbol id and dxFeed C-API dxf_order_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param order The dxFeed C-API dxf_order_t object
+     * @param typeTag The type tag of the event (see Event::getTypeTag)
+     */
+    OrderBase(SymbolTable::IdType eventSymbolId, const dxf_order_t &order, unsigned typeTag)
+        : MarketEvent(eventSymbolId, typeTag), eventFlags_(order.event_flags),
+          index_{static_cast<std::uint64_t>(order.index)}, time_{static_cast<std::uint64_t>(order.time)},
+          sequence_{order.sequence}, timeNanoPart_{order.time_nanos}, action_{order.action},
+          actionTime_{static_cast<std::uint64_t>(order.action_time)}, orderId_{order.order_id},
+          auxOrderId_{order.aux_order_id}, price_{order.price}, size_{order.size},
+          executedSize_{order.executed_size}, count_{order.count}, tradeId_{order.trade_id},
+          tradePrice_{order.trade_price}, tradeSize_{order.trade_size}, exchangeCode_{order.exchange_code},
+          side_{order.side}, scope_{order.scope} {
+        for (std::size_t i = 0; i < DXF_RECORD_SUFFIX_SIZE; i++) {
+            source_[i] = order.source[i];
+        }
+    }
+
+    /// Returns a string representation of the base fields
+    std::string baseFieldsToString() const {
+        return getEventSymbol() + ", eventTime=" + DateTimeConverter::toISO(getEventTime()) +
+            ", source=" + getSourceName() + ", eventFlags=" + eventFlags_.toString() + ", index=" +
+            string::toHex(index_) + ", time=" + DateTimeConverter::toISO(time_) + ", sequence=" +
+            std::to_string(sequence_) + ", timeNanoPart=" + std::to_string(timeNanoPart_) + ", action=" +
+            std::to_string(action_) + ", actionTime=" + DateTimeConverter::toISO(actionTime_) + ", orderId=" +
+            std::to_string(orderId_) + ", auxOrderId=" + std::to_string(auxOrderId_) + ", price=" +
+            std::to_string(price_) + ", size=" + std::to_string(size_) + ", executedSize=" +
+            std::to_string(executedSize_) + ", count=" + std::to_string(count_) + ", exchange=" +
+            exchangeCodeToString(getExchangeCode()) + ", side=" + std::to_string(side_) + ", scope=" +
+            getScope().toString() + ", tradeId=" + std::to_string(tradeId_) + ", tradePrice=" +
+            std::to_string(tradePrice_) + ", tradeSize=" + std::to_string(tradeSize_);
+    }
 
   public:
+    OrderBase &operator=(const OrderBase &other) = delete;
+
+    OrderBase &operator=(OrderBase &&other) = delete;
+
     // TODO: OrderSource
     const IndexedEventSource &getSource() const override { return IndexedEventSource::DEFAULT; }
+
+    /// Returns the name of the source of this order (for example, "NTV")
+    std::string getSourceName() const {
+        auto length = std::find(source_, source_ + DXF_RECORD_SUFFIX_SIZE, 0) - source_;
+
+        return StringConverter::wStringToUtf8(source_, static_cast<std::size_t>(length));
+    }
+
     const EventFlagsMask &getEventFlags() const override { return eventFlags_; }
-    void setEventFlags(const EventFlagsMask &mask) override {}
-    uint64_t getIndex() const override { return 0; }
-    void setIndex(std::uint64_t uint64) override {}
+
+    void setEventFlags(const EventFlagsMask &mask) override { eventFlags_ = mask; }
+
+    std::uint64_t getIndex() const override { return index_; }
+
+    void setIndex(std::uint64_t index) override { index_ = index; }
+
+    /// Returns time of this order
+    std::uint64_t getTime() const { return time_; }
+
+    /// Returns the sequence number of this order (to distinguish orders that have the same time)
+    std::int32_t getSequence() const { return sequence_; }
+
+    /// Returns microseconds and nanoseconds part of time of this order
+    std::int32_t getTimeNanoPart() const { return timeNanoPart_; }
+
+    /// Returns the action of this order (the C-API value)
+    dxf_order_action_t getAction() const { return action_; }
+
+    /// Returns time of the last action of this order
+    std::uint64_t getActionTime() const { return actionTime_; }
+
+    /// Returns the order id
+    std::int64_t getOrderId() const { return orderId_; }
+
+    /// Returns the auxiliary order id
+    std::int64_t getAuxOrderId() const { return auxOrderId_; }
+
+    /// Returns price of this order
+    double getPrice() const { return price_; }
+
+    /// Returns size of this order
+    double getSize() const { return size_; }
+
+    /// Returns executed size of this order
+    double getExecutedSize() const { return executedSize_; }
+
+    /// Returns the number of individual orders in this aggregate order
+    std::int64_t getCount() const { return count_; }
+
+    /// Returns the trade id
+    std::int64_t getTradeId() const { return tradeId_; }
+
+    /// Returns the trade price
+    double getTradePrice() const { return tradePrice_; }
+
+    /// Returns the trade size
+    double getTradeSize() const { return tradeSize_; }
+
+    /// Returns exchange code of this order
+    char getExchangeCode() const { return StringConverter::wCharToUtf8(exchangeCode_); }
+
+    /// Returns side of this order (the C-API value)
+    dxf_order_side_t getOrderSide() const { return side_; }
+
+    /// Returns scope of this order
+    OrderScope getScope() const { return OrderScope::get(scope_); }
 };
 
-struct Order final : virtual public OrderBase {
+/**
+ * Order event is a snapshot for a full available market depth for a symbol.
+ * The collection of order events of a symbol represents the most recent information that is available about orders on
+ * the market at any given moment of time.
+ */
+struct Order final : public OrderBase {
     /// The alias to a type of shared pointer to the Order object
     using Ptr = std::shared_ptr<Order>;
 
-    std::string toString() const override { return std::string(); }
+    /// The alias to a type of intrusive handle to the Order object
+    using Handle = IntrusivePtr<Order>;
+
+  private:
+    /// The market maker or other aggregate identifier of this order
+    std::string marketMaker_{};
+
+  public:
+    /**
+     * Creates new order with the specified event symbol
+     *
+     * @param eventSymbol The event symbol
+     */
+    explicit Order(const std::string &eventSymbol) : OrderBase(eventSymbol, EventTraits<Order>::cApiEventId) {}
+
+    /**
+     * Creates new order with the specified event symbol and dxFeed C-API dxf_order_t
+     *
+     * @param eventSymbol The event symbol
+     * @param order The dxFeed C-API dxf_order_t object
+     */
+    Order(const std::string &eventSymbol, const dxf_order_t &order)
+        : Order(SymbolTable::getInstance().intern(eventSymbol), order) {}
+
+    /**
+     * Creates new order with the specified event symbol id and dxFeed C-API dxf_order_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param order The dxFeed C-API dxf_order_t object
+     */
+    Order(SymbolTable::IdType eventSymbolId, const dxf_order_t &order)
+        : OrderBase(eventSymbolId, order, EventTraits<Order>::cApiEventId),
+          marketMaker_{StringConverter::wStringToUtf8(order.market_maker)} {}
+
+    /// Returns the market maker or other aggregate identifier of this order
+    const std::string &getMarketMaker() const { return marketMaker_; }
+
+    /// Returns a string representation of the order
+    std::string toString() const override {
+        return "Order{" + baseFieldsToString() + ", marketMaker='" + getMarketMaker() + "'}";
+    }
 };
 
-struct SpreadOrder final : virtual public OrderBase {
+/**
+ * Spread order event is a snapshot for a full available market depth for all spreads on a given underlying symbol.
+ */
+struct SpreadOrder final : public OrderBase {
     /// The alias to a type of shared pointer to the SpreadOrder object
     using Ptr = std::shared_ptr<SpreadOrder>;
 
-    std::string toString() const override { return std::string(); }
+    /// The alias to a type of intrusive handle to the SpreadOrder object
+    using Handle = IntrusivePtr<SpreadOrder>;
+
+  private:
+    /// The id of the spread symbol of this event in the SymbolTable
+    SymbolTable::IdType spreadSymbolId_{SymbolTable::EMPTY_SYMBOL_ID};
+
+  public:
+    /**
+     * Creates new spread order with the specified event symbol
+     *
+     * @param eventSymbol The event symbol
+     */
+    explicit SpreadOrder(const std::string &eventSymbol)
+        : OrderBase(eventSymbol, EventTraits<SpreadOrder>::cApiEventId) {}
+
+    /**
+     * Creates new spread order with the specified event symbol and dxFeed C-API dxf_order_t
+     *
+     * @param eventSymbol The event symbol
+     * @param order The dxFeed C-API dxf_order_t object
+     */
+    SpreadOrder(const std::string &eventSymbol, const dxf_order_t &order)
+        : SpreadOrder(SymbolTable::getInstance().intern(eventSymbol), order) {}
+
+    /**
+     * Creates new spread order with the specified event symbol id and dxFeed C-API dxf_order_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param order The dxFeed C-API dxf_order_t object
+     */
+    SpreadOrder(SymbolTable::IdType eventSymbolId, const dxf_order_t &order)
+        : OrderBase(eventSymbolId, order, EventTraits<SpreadOrder>::cApiEventId),
+          spreadSymbolId_{SymbolTable::getInstance().intern(order.spread_symbol)} {}
+
+    /// Returns the spread symbol of this event
+    const std::string &getSpreadSymbol() const { return SymbolTable::getInstance().getSymbol(spreadSymbolId_); }
+
+    /// Returns the id of the spread symbol of this event in the SymbolTable
+    SymbolTable::IdType getSpreadSymbolId() const { return spreadSymbolId_; }
+
+    /// Returns a string representation of the spread order
+    std::string toString() const override {
+        return "SpreadOrder{" + baseFieldsToString() + ", spreadSymbol=" + getSpreadSymbol() + "}";
+    }
 };
 
-} // namespace dxfcpp
\ No newline at end of file
+} // namespace dxfcpp
@@ -8,11 +8,14 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
 #include <string>
-#include <unordered_map>
+#include <utility>
 
 #include "common/DXFCppConfig.hpp"
 
+#include "utils/Utils.hpp"
+
 namespace std {
 
 template <> struct hash<dxf_order_scope_t> {
@@ -25,12 +28,22 @@ namespace dxfcpp {
 
 /**
  * Wrapper over the dxf_order_scope_t enum
+ *
+ * It is a one-byte literal type: the wrapper holds the index of the scope in the static table of the names, so
+ * getting the wrapper of the C-API scope does not allocate and does not look up the hash maps. The table is initialized
+ * out of the class, so it is built in the DXFCPP_USE_CONSTEXPR == const mode too.
  */
-class OrderScope {
-    dxf_order_scope_t scope_;
-    std::string name_;
+class OrderScope final {
+    // The C-API value of the known scopes, UNKNOWN_CODE for the others
+    std::uint8_t code_;
+
+    static DXFCPP_USE_CONSTEXPR std::uint8_t UNKNOWN_CODE = 4;
 
-    OrderScope(dxf_order_scope_t scope, std::string name) : scope_{scope}, name_{std::move(name)} {}
+    template <typename = void> struct Names {
+        static const StringView VALUES[];
+    };
+
+    explicit DXFCPP_CONSTEXPR OrderScope(std::uint8_t code) noexcept : code_{code} {}
 
   public:
     static const OrderScope COMPOSITE;
@@ -39,38 +52,37 @@ class OrderScope {
     static const OrderScope ORDER;
     static const OrderScope UNKNOWN;
 
-    const static std::unordered_map<dxf_order_scope_t, OrderScope> ALL;
-
-    static OrderScope get(dxf_order_scope_t scope) {
-        auto found = ALL.find(scope);
-
-        if (found != ALL.end()) {
-            return found->second;
-        }
+    /// Returns the wrapper of the C-API scope or UNKNOWN
+    static DXFCPP_CONSTEXPR OrderScope get(dxf_order_scope_t scope) noexcept {
+        return OrderScope(static_cast<int>(scope) >= 0 && static_cast<int>(scope) < UNKNOWN_CODE
+                              ? static_cast<std::uint8_t>(scope)
+                              : UNKNOWN_CODE);
+    }
 
-        return UNKNOWN;
+    DXFCPP_CONSTEXPR dxf_order_scope_t getScope() const noexcept {
+        return code_ == UNKNOWN_CODE ? static_cast<dxf_order_scope_t>(256) : static_cast<dxf_order_scope_t>(code_);
     }
 
-    dxf_order_scope_t getScope() const { return scope_; }
+    StringView getName() const noexcept { return Names<>::VALUES[code_]; }
+
+    std::string toString() const { return getName().toString(); }
 
-    const std::string &getName() const { return name_; }
+    DXFCPP_CONSTEXPR bool operator==(const OrderScope &other) const noexcept { return code_ == other.code_; }
 
-    std::string toString() const { return name_; }
+    DXFCPP_CONSTEXPR bool operator!=(const OrderScope &other) const noexcept { return code_ != other.code_; }
 
     template <class Ostream> friend Ostream &&operator<<(Ostream &&os, const OrderScope &value) {
-        return std::forward<Ostream>(os) << value.toString();
+        return std::forward<Ostream>(os) << value.getName();
     }
 };
 
-const OrderScope OrderScope::COMPOSITE{dxf_osc_composite, "Composite"};
-const OrderScope OrderScope::REGIONAL{dxf_osc_regional, "Regional"};
-const OrderScope OrderScope::AGGREGATE{dxf_osc_aggregate, "Aggregate"};
-const OrderScope OrderScope::ORDER{dxf_osc_order, "Order"};
-const OrderScope OrderScope::UNKNOWN{static_cast<dxf_order_scope_t>(256), "Unknown"};
+template <typename T>
+const StringView OrderScope::Names<T>::VALUES[] = {"Composite", "Regional", "Aggregate", "Order", "Unknown"};
 
-const std::unordered_map<dxf_order_scope_t, OrderScope> OrderScope::ALL{{COMPOSITE.getScope(), COMPOSITE},
-                                                                        {REGIONAL.getScope(), REGIONAL},
-                                                                        {AGGREGATE.getScope(), AGGREGATE},
-                                                                        {ORDER.getScope(), ORDER}};
+DXFCPP_USE_CONSTEXPR OrderScope OrderScope::COMPOSITE{dxf_osc_composite};
+DXFCPP_USE_CONSTEXPR OrderScope OrderScope::REGIONAL{dxf_osc_regional};
+DXFCPP_USE_CONSTEXPR OrderScope OrderScope::AGGREGATE{dxf_osc_aggregate};
+DXFCPP_USE_CONSTEXPR OrderScope OrderScope::ORDER{dxf_osc_order};
+DXFCPP_USE_CONSTEXPR OrderScope OrderScope::UNKNOWN{OrderScope::UNKNOWN_CODE};
 
-} // namespace dxfcpp
\ No newline at end of file
+} // namespace dxfcpp
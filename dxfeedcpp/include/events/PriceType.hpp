@@ -8,11 +8,13 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 
 #include "common/DXFCppConfig.hpp"
 
+#include "utils/Utils.hpp"
+
 namespace std {
 
 template <> struct hash<dxf_price_type_t> {
@@ -27,13 +29,20 @@ namespace dxfcpp {
  * Wrapper over the dxf_price_type_t enum
  *
  * Type of the price value.
+ *
+ * It is a one-byte literal type with the static table of the names (see OrderScope).
  */
-class PriceType {
-    dxf_price_type_t priceType_;
+class PriceType final {
+    // The C-API value of the known price types, UNKNOWN_CODE for the others
+    std::uint8_t code_;
 
-    std::string name_;
+    static DXFCPP_USE_CONSTEXPR std::uint8_t UNKNOWN_CODE = 4;
 
-    PriceType(dxf_price_type_t priceType, std::string name) : priceType_{priceType}, name_{std::move(name)} {}
+    template <typename = void> struct Names {
+        static const StringView VALUES[];
+    };
+
+    explicit DXFCPP_CONSTEXPR PriceType(std::uint8_t code) noexcept : code_{code} {}
 
   public:
     /**
@@ -61,38 +70,37 @@ class PriceType {
      */
     static const PriceType UNKNOWN;
 
-    const static std::unordered_map<dxf_price_type_t, PriceType> ALL;
-
-    static PriceType get(dxf_price_type_t priceType) {
-        auto found = ALL.find(priceType);
-
-        if (found != ALL.end()) {
-            return found->second;
-        }
+    /// Returns the wrapper of the C-API price type or UNKNOWN
+    static DXFCPP_CONSTEXPR PriceType get(dxf_price_type_t priceType) noexcept {
+        return PriceType(static_cast<int>(priceType) >= 0 && static_cast<int>(priceType) < UNKNOWN_CODE
+                             ? static_cast<std::uint8_t>(priceType)
+                             : UNKNOWN_CODE);
+    }
 
-        return UNKNOWN;
+    DXFCPP_CONSTEXPR dxf_price_type_t getPriceType() const noexcept {
+        return code_ == UNKNOWN_CODE ? static_cast<dxf_price_type_t>(256) : static_cast<dxf_price_type_t>(code_);
     }
 
-    dxf_price_type_t getPriceType() const { return priceType_; }
+    StringView getName() const noexcept { return Names<>::VALUES[code_]; }
+
+    std::string toString() const { return getName().toString(); }
 
-    const std::string &getName() const { return name_; }
+    DXFCPP_CONSTEXPR bool operator==(const PriceType &other) const noexcept { return code_ == other.code_; }
 
-    std::string toString() const { return name_; }
+    DXFCPP_CONSTEXPR bool operator!=(const PriceType &other) const noexcept { return code_ != other.code_; }
 
     template <class Ostream> friend Ostream &&operator<<(Ostream &&os, const PriceType &value) {
-        return std::forward<Ostream>(os) << value.toString();
+        return std::forward<Ostream>(os) << value.getName();
     }
 };
 
-const PriceType PriceType::REGULAR{dxf_pt_regular, "Regular"};
-const PriceType PriceType::INDICATIVE{dxf_pt_indicative, "Indicative"};
-const PriceType PriceType::PRELIMINARY{dxf_pt_preliminary, "Preliminary"};
-const PriceType PriceType::FINAL{dxf_pt_final, "Final"};
-const PriceType PriceType::UNKNOWN{static_cast<dxf_price_type_t>(256), "Unknown"};
+template <typename T>
+const StringView PriceType::Names<T>::VALUES[] = {"Regular", "Indicative", "Preliminary", "Final", "Unknown"};
 
-const std::unordered_map<dxf_price_type_t, PriceType> PriceType::ALL{{REGULAR.getPriceType(), REGULAR},
-                                                                     {INDICATIVE.getPriceType(), INDICATIVE},
-                                                                     {PRELIMINARY.getPriceType(), PRELIMINARY},
-                                                                     {FINAL.getPriceType(), FINAL}};
+DXFCPP_USE_CONSTEXPR PriceType PriceType::REGULAR{dxf_pt_regular};
+DXFCPP_USE_CONSTEXPR PriceType PriceType::INDICATIVE{dxf_pt_indicative};
+DXFCPP_USE_CONSTEXPR PriceType PriceType::PRELIMINARY{dxf_pt_preliminary};
+DXFCPP_USE_CONSTEXPR PriceType PriceType::FINAL{dxf_pt_final};
+DXFCPP_USE_CONSTEXPR PriceType PriceType::UNKNOWN{PriceType::UNKNOWN_CODE};
 
-} // namespace dxfcpp
\ No newline at end of file
+} // namespace dxfcpp
@@ -8,12 +8,17 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <utility>
 
 #include "common/DXFCppConfig.hpp"
 
 #include "converters/DateTimeConverter.hpp"
+#include "converters/StringConverter.hpp"
+
+#include "utils/Utils.hpp"
 
 #include "Event.hpp"
 #include "EventFlags.hpp"
@@ -21,11 +26,165 @@ extern "C" {
 
 namespace dxfcpp {
 
+/**
+ * Profile information snapshot that contains security instrument description.
+ * It represents the most recent information that is available about the traded security on the market at any given
+ * moment of time.
+ */
 struct Profile final : public MarketEvent, public Lasting {
     /// The alias to a type of shared pointer to the Profile object
     using Ptr = std::shared_ptr<Profile>;
 
-    std::string toString() const override { return std::string(); }
+    /// The alias to a type of intrusive handle to the Profile object
+    using Handle = IntrusivePtr<Profile>;
+
+  private:
+    /// The correlation coefficient of the instrument to the S&P500 index
+    double beta_{std::numeric_limits<double>::quiet_NaN()};
+    /// Earnings per share (the company’s profits divided by the number of shares)
+    double eps_{std::numeric_limits<double>::quiet_NaN()};
+    /// Frequency of cash dividends payments per year (calculated)
+    double divFreq_{std::numeric_limits<double>::quiet_NaN()};
+    /// The amount of the last paid dividend
+    double exdDivAmount_{std::numeric_limits<double>::quiet_NaN()};
+    /// Identifier of the day of the last dividend payment (ex-dividend date)
+    std::int32_t exdDivDate_{};
+    /// Maximal (high) price in last 52 weeks
+    double high52WeekPrice_{std::numeric_limits<double>::quiet_NaN()};
+    /// Minimal (low) price in last 52 weeks
+    double low52WeekPrice_{std::numeric_limits<double>::quiet_NaN()};
+    /// Shares outstanding
+    double shares_{std::numeric_limits<double>::quiet_NaN()};
+    /// Free-float - the number of shares outstanding that are available to the public for trade
+    double freeFloat_{std::numeric_limits<double>::quiet_NaN()};
+    /// Maximal (high) allowed price
+    double highLimitPrice_{std::numeric_limits<double>::quiet_NaN()};
+    /// Minimal (low) allowed price
+    double lowLimitPrice_{std::numeric_limits<double>::quiet_NaN()};
+    /// Starting time of the trading halt interval
+    std::uint64_t haltStartTime_{};
+    /// Ending time of the trading halt interval
+    std::uint64_t haltEndTime_{};
+    /// The raw flags (the trading status and the short sale restriction)
+    std::uint32_t rawFlags_{};
+    /// The description of the security instrument
+    std::string description_{};
+    /// The description of the reason that trading was halted
+    std::string statusReason_{};
+    /// The trading status of the security instrument (the C-API value)
+    dxf_trading_status_t tradingStatus_{};
+    /// The short sale restriction of the security instrument (the C-API value)
+    dxf_short_sale_restriction_t shortSaleRestriction_{};
+
+  public:
+    /**
+     * Creates new profile with the specified event symbol
+     *
+     * @param eventSymbol The event symbol
+     */
+    explicit Profile(const std::string &eventSymbol) : MarketEvent(eventSymbol, EventTraits<Profile>::cApiEventId) {}
+
+    /**
+     * Creates new profile with the specified event symbol and dxFeed C-API dxf_profile_t
+     *
+     * @param eventSymbol The event symbol
+     * @param profile The dxFeed C-API dxf_profile_t object
+     */
+    Profile(const std::string &eventSymbol, const dxf_profile_t &profile)
+        : Profile(SymbolTable::getInstance().intern(eventSymbol), profile) {}
+
+    /**
+     * Creates new profile with the specified event symbol id and dxFeed C-API dxf_profile_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param profile The dxFeed C-API dxf_profile_t object
+     */
+    Profile(SymbolTable::IdType eventSymbolId, const dxf_profile_t &profile)
+        : MarketEvent(eventSymbolId, EventTraits<Profile>::cApiEventId), beta_{profile.beta}, eps_{profile.eps},
+          divFreq_{profile.div_freq}, exdDivAmount_{profile.exd_div_amount}, exdDivDate_{profile.exd_div_date},
+          high52WeekPrice_{profile.high_52_week_price}, low52WeekPrice_{profile.low_52_week_price},
+          shares_{profile.shares}, freeFloat_{profile.free_float}, highLimitPrice_{profile.high_limit_price},
+          lowLimitPrice_{profile.low_limit_price}, haltStartTime_{static_cast<std::uint64_t>(profile.halt_start_time)},
+          haltEndTime_{static_cast<std::uint64_t>(profile.halt_end_time)},
+          rawFlags_{static_cast<std::uint32_t>(profile.raw_flags)},
+          description_{StringConverter::wStringToUtf8(profile.description)},
+          statusReason_{StringConverter::wStringToUtf8(profile.status_reason)},
+          tradingStatus_{profile.trading_status}, shortSaleRestriction_{profile.ssr} {}
+
+    Profile &operator=(const Profile &other) = delete;
+
+    Profile &operator=(Profile &&other) = delete;
+
+    /// Returns the correlation coefficient of the instrument to the S&P500 index
+    double getBeta() const { return beta_; }
+
+    /// Returns the earnings per share
+    double getEps() const { return eps_; }
+
+    /// Returns the frequency of cash dividends payments per year
+    double getDivFreq() const { return divFreq_; }
+
+    /// Returns the amount of the last paid dividend
+    double getExdDivAmount() const { return exdDivAmount_; }
+
+    /// Returns the identifier of the day of the last dividend payment (ex-dividend date)
+    std::int32_t getExdDivDate() const { return exdDivDate_; }
+
+    /// Returns the maximal (high) price in last 52 weeks
+    double getHigh52WeekPrice() const { return high52WeekPrice_; }
+
+    /// Returns the minimal (low) price in last 52 weeks
+    double getLow52WeekPrice() const { return low52WeekPrice_; }
+
+    /// Returns the shares outstanding
+    double getShares() const { return shares_; }
+
+    /// Returns the free-float
+    double getFreeFloat() const { return freeFloat_; }
+
+    /// Returns the maximal (high) allowed price
+    double getHighLimitPrice() const { return highLimitPrice_; }
+
+    /// Returns the minimal (low) allowed price
+    double getLowLimitPrice() const { return lowLimitPrice_; }
+
+    /// Returns the starting time of the trading halt interval
+    std::uint64_t getHaltStartTime() const { return haltStartTime_; }
+
+    /// Returns the ending time of the trading halt interval
+    std::uint64_t getHaltEndTime() const { return haltEndTime_; }
+
+    /// Returns the raw flags of the profile
+    std::uint32_t getRawFlags() const { return rawFlags_; }
+
+    /// Returns the description of the security instrument
+    const std::string &getDescription() const { return description_; }
+
+    /// Returns the description of the reason that trading was halted
+    const std::string &getStatusReason() const { return statusReason_; }
+
+    /// Returns the trading status of the security instrument (the C-API value)
+    dxf_trading_status_t getTradingStatus() const { return tradingStatus_; }
+
+    /// Returns the short sale restriction of the security instrument (the C-API value)
+    dxf_short_sale_restriction_t getShortSaleRestriction() const { return shortSaleRestriction_; }
+
+    /// Returns a string representation of the entity
+    std::string toString() const override {
+        return "Profile{" + getEventSymbol() + ", eventTime=" + DateTimeConverter::toISO(getEventTime()) +
+            ", description='" + getDescription() + "', tradingStatus=" + std::to_string(tradingStatus_) +
+            ", statusReason='" + getStatusReason() + "', haltStartTime=" + DateTimeConverter::toISO(haltStartTime_) +
+            ", haltEndTime=" + DateTimeConverter::toISO(haltEndTime_) +
+            ", highLimitPrice=" + std::to_string(highLimitPrice_) +
+            ", lowLimitPrice=" + std::to_string(lowLimitPrice_) +
+            ", high52WeekPrice=" + std::to_string(high52WeekPrice_) +
+            ", low52WeekPrice=" + std::to_string(low52WeekPrice_) + ", beta=" + std::to_string(beta_) +
+            ", eps=" + std::to_string(eps_) + ", divFreq=" + std::to_string(divFreq_) +
+            ", exdDivAmount=" + std::to_string(exdDivAmount_) +
+            ", exdDivDate=" + std::to_string(day_util::getYearMonthDayByDayId(exdDivDate_)) +
+            ", shares=" + std::to_string(shares_) + ", freeFloat=" + std::to_string(freeFloat_) +
+            ", ssr=" + std::to_string(shortSaleRestriction_) + ", rawFlags=" + string::toHex(rawFlags_) + '}';
+    }
 };
 
-} // namespace dxfcpp
\ No newline at end of file
+} // namespace dxfcpp
@@ -8,7 +8,9 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "common/DXFCppConfig.hpp"
@@ -17,10 +19,37 @@ extern "C" {
 #include "converters/StringConverter.hpp"
 
 #include "Event.hpp"
+#include "EventView.hpp"
 #include "OrderScope.hpp"
 
 namespace dxfcpp {
 
+/**
+ * The compact trivially copyable record of the Quote fields: the symbol is stored as the SymbolTable id, the exchange
+ * codes and the scope are stored as the C-API codes, and the fields are ordered by size (88 bytes on the most
+ * platforms). The records can be kept by value in flat arrays (caches, ring buffers, recordings) and can be copied by
+ * memcpy. Quote::toRecord() and QuoteView::toRecord() create the record, Quote(const QuoteRecord &) restores the event.
+ */
+struct QuoteRecord {
+    std::uint64_t eventTime;
+    std::uint64_t time;
+    std::uint64_t bidTime;
+    double bidPrice;
+    double bidSize;
+    std::uint64_t askTime;
+    double askPrice;
+    double askSize;
+    SymbolTable::IdType eventSymbolId;
+    std::int32_t sequence;
+    std::int32_t timeNanoPart;
+    dxf_char_t bidExchangeCode;
+    dxf_char_t askExchangeCode;
+    dxf_order_scope_t scope;
+};
+
+static_assert(std::is_trivially_copyable<QuoteRecord>::value, "QuoteRecord must be trivially copyable");
+static_assert(sizeof(QuoteRecord) <= 128, "QuoteRecord must fit in two cache lines");
+
 /**
  * @brief Quote.
  *
@@ -32,6 +61,12 @@ struct Quote final : public MarketEvent, public Lasting {
     /// The alias to a type of shared pointer to the Quote object
     using Ptr = std::shared_ptr<Quote>;
 
+    /// The alias to a type of intrusive handle to the Quote object
+    using Handle = IntrusivePtr<Quote>;
+
+    /// The alias to a type of the compact record of the Quote fields
+    using Record = QuoteRecord;
+
   private:
     /// Time of the last bid or ask change
     std::uint64_t time_{};
@@ -41,16 +76,16 @@ struct Quote final : public MarketEvent, public Lasting {
     std::int32_t timeNanoPart_{};
     /// Time of the last bid change
     std::uint64_t bidTime_{};
-    /// Bid exchange code
-    char bidExchangeCode_{};
+    /// Bid exchange code (the C-API value, it is converted by the getter)
+    dxf_char_t bidExchangeCode_{};
     /// Bid price
     double bidPrice_{std::numeric_limits<double>::quiet_NaN()};
     /// Bid size
     double bidSize_{std::numeric_limits<double>::quiet_NaN()};
     /// Time of the last ask change
     std::uint64_t askTime_{};
-    /// Ask exchange code
-    char askExchangeCode_{};
+    /// Ask exchange code (the C-API value, it is converted by the getter)
+    dxf_char_t askExchangeCode_{};
     /// Ask price
     double askPrice_{std::numeric_limits<double>::quiet_NaN()};
     /// Ask size
@@ -59,8 +94,10 @@ struct Quote final : public MarketEvent, public Lasting {
      * Scope of this quote.
      *
      * Possible values: #OrderScope::COMPOSITE(Quote events) , #OrderScope::REGIONAL (Quote& events)
+     *
+     * The C-API value, it is converted by the getter.
      */
-    OrderScope scope_;
+    dxf_order_scope_t scope_;
 
   public:
     Quote(const Quote &other)
@@ -76,44 +113,79 @@ struct Quote final : public MarketEvent, public Lasting {
           timeNanoPart_{other.timeNanoPart_}, bidTime_{other.bidTime_}, bidExchangeCode_{other.bidExchangeCode_},
           bidPrice_{other.bidPrice_}, bidSize_{other.bidSize_}, askTime_{other.askTime_},
           askExchangeCode_{other.askExchangeCode_}, askPrice_{other.askPrice_}, askSize_{other.askSize_},
-          scope_{std::move(other.scope_)} {}
+          scope_{other.scope_} {}
 
     Quote &operator=(Quote &&other) noexcept = delete;
 
-    explicit Quote(std::string eventSymbol) : MarketEvent(std::move(eventSymbol)), scope_(OrderScope::UNKNOWN) {}
+    explicit Quote(const std::string &eventSymbol)
+        : MarketEvent(eventSymbol, EventTraits<Quote>::cApiEventId), scope_(OrderScope::UNKNOWN.getScope()) {}
     void setEventSymbol(const std::string &eventSymbol) override { MarketEvent::setEventSymbol(eventSymbol); }
     void setEventTime(std::uint64_t eventTime) override { MarketEvent::setEventTime(eventTime); }
-    Quote(std::string eventSymbol, dxf_quote_t const &quote)
-        : MarketEvent(std::move(eventSymbol)), time_{static_cast<std::uint64_t>(quote.time)}, sequence_{quote.sequence},
-          timeNanoPart_{quote.time_nanos}, bidTime_{static_cast<std::uint64_t>(quote.bid_time)},
-          bidExchangeCode_{StringConverter::wCharToUtf8(quote.bid_exchange_code)}, bidPrice_{quote.bid_price},
-          bidSize_{quote.bid_size}, askTime_{static_cast<std::uint64_t>(quote.ask_time)},
-          askExchangeCode_{StringConverter::wCharToUtf8(quote.ask_exchange_code)}, askPrice_{quote.ask_price},
-          askSize_{quote.ask_size}, scope_{OrderScope::get(quote.scope)} {}
+    Quote(const std::string &eventSymbol, dxf_quote_t const &quote)
+        : Quote(SymbolTable::getInstance().intern(eventSymbol), quote) {}
+    Quote(SymbolTable::IdType eventSymbolId, dxf_quote_t const &quote)
+        : MarketEvent(eventSymbolId, EventTraits<Quote>::cApiEventId), time_{static_cast<std::uint64_t>(quote.time)},
+          sequence_{quote.sequence}, timeNanoPart_{quote.time_nanos},
+          bidTime_{static_cast<std::uint64_t>(quote.bid_time)},
+          bidExchangeCode_{quote.bid_exchange_code}, bidPrice_{quote.bid_price}, bidSize_{quote.bid_size},
+          askTime_{static_cast<std::uint64_t>(quote.ask_time)}, askExchangeCode_{quote.ask_exchange_code},
+          askPrice_{quote.ask_price}, askSize_{quote.ask_size}, scope_{quote.scope} {}
+
+    /**
+     * Creates new quote with the fields of the record
+     *
+     * @param record The record
+     */
+    explicit Quote(const QuoteRecord &record)
+        : MarketEvent(record.eventSymbolId, EventTraits<Quote>::cApiEventId), time_{record.time},
+          sequence_{record.sequence}, timeNanoPart_{record.timeNanoPart}, bidTime_{record.bidTime},
+          bidExchangeCode_{record.bidExchangeCode}, bidPrice_{record.bidPrice}, bidSize_{record.bidSize},
+          askTime_{record.askTime}, askExchangeCode_{record.askExchangeCode}, askPrice_{record.askPrice},
+          askSize_{record.askSize}, scope_{record.scope} {
+        MarketEvent::setEventTime(record.eventTime);
+    }
+
+    /// Returns the compact record of the fields of this quote
+    QuoteRecord toRecord() const {
+        return QuoteRecord{getEventTime(),
+                           time_,
+                           bidTime_,
+                           bidPrice_,
+                           bidSize_,
+                           askTime_,
+                           askPrice_,
+                           askSize_,
+                           getEventSymbolId(),
+                           sequence_,
+                           timeNanoPart_,
+                           bidExchangeCode_,
+                           askExchangeCode_,
+                           scope_};
+    }
     const std::string &getEventSymbol() const override { return MarketEvent::getEventSymbol(); }
     std::uint64_t getEventTime() const override { return MarketEvent::getEventTime(); }
     std::uint64_t getTime() const { return time_; }
     std::int32_t getSequence() const { return sequence_; }
     std::int32_t getTimeNanoPart() const { return timeNanoPart_; }
     std::uint64_t getBidTime() const { return bidTime_; }
-    char getBidExchangeCode() const { return bidExchangeCode_; }
+    char getBidExchangeCode() const { return StringConverter::wCharToUtf8(bidExchangeCode_); }
     double getBidPrice() const { return bidPrice_; }
     double getBidSize() const { return bidSize_; }
     std::uint64_t getAskTime() const { return askTime_; }
-    char getAskExchangeCode() const { return askExchangeCode_; }
+    char getAskExchangeCode() const { return StringConverter::wCharToUtf8(askExchangeCode_); }
     double getAskPrice() const { return askPrice_; }
     double getAskSize() const { return askSize_; }
-    const OrderScope &getScope() const { return scope_; }
+    OrderScope getScope() const { return OrderScope::get(scope_); }
 
     std::string toString() const override {
         return std::string("Quote") + "{" + getEventSymbol() +
             ", eventTime=" + DateTimeConverter::toISO(getEventTime()) + ", time=" + DateTimeConverter::toISO(time_) +
             ", timeNanoPart=" + std::to_string(timeNanoPart_) + ", sequence=" + std::to_string(sequence_) +
             ", bidTime=" + DateTimeConverter::toISO(bidTime_) +
-            ", bidExchange=" + exchangeCodeToString(bidExchangeCode_) + ", bidPrice=" + std::to_string(bidPrice_) +
+            ", bidExchange=" + exchangeCodeToString(getBidExchangeCode()) + ", bidPrice=" + std::to_string(bidPrice_) +
             ", bidSize=" + std::to_string(bidSize_) + ", askTime=" + DateTimeConverter::toISO(askTime_) +
-            ", askExchange=" + exchangeCodeToString(askExchangeCode_) + ", askPrice=" + std::to_string(askPrice_) +
-            ", askSize=" + std::to_string(askSize_) + ", scope=" + scope_.toString() + "}";
+            ", askExchange=" + exchangeCodeToString(getAskExchangeCode()) + ", askPrice=" + std::to_string(askPrice_) +
+            ", askSize=" + std::to_string(askSize_) + ", scope=" + getScope().toString() + "}";
     }
 
     template <class Ostream> friend Ostream &&operator<<(Ostream &&os, const Quote &value) {
@@ -123,4 +195,45 @@ struct Quote final : public MarketEvent, public Lasting {
     ~Quote() override = default;
 };
 
+/**
+ * The non-owning view of the dxFeed C-API quote with the same getters as Quote. It is valid only during the listener
+ * call (see SubscriptionImpl::onView); materialize() creates the Quote.
+ */
+struct QuoteView final : public EventView<Quote, dxf_quote_t> {
+    using EventView<Quote, dxf_quote_t>::EventView;
+
+    std::uint64_t getTime() const { return static_cast<std::uint64_t>(getData().time); }
+    std::int32_t getSequence() const { return getData().sequence; }
+    std::int32_t getTimeNanoPart() const { return getData().time_nanos; }
+    std::uint64_t getBidTime() const { return static_cast<std::uint64_t>(getData().bid_time); }
+    char getBidExchangeCode() const { return StringConverter::wCharToUtf8(getData().bid_exchange_code); }
+    double getBidPrice() const { return getData().bid_price; }
+    double getBidSize() const { return getData().bid_size; }
+    std::uint64_t getAskTime() const { return static_cast<std::uint64_t>(getData().ask_time); }
+    char getAskExchangeCode() const { return StringConverter::wCharToUtf8(getData().ask_exchange_code); }
+    double getAskPrice() const { return getData().ask_price; }
+    double getAskSize() const { return getData().ask_size; }
+    OrderScope getScope() const { return OrderScope::get(getData().scope); }
+
+    /// Returns the compact record of the fields of the quote (without creating the Quote)
+    QuoteRecord toRecord() const {
+        const auto &data = getData();
+
+        return QuoteRecord{getEventTime(),
+                           getTime(),
+                           getBidTime(),
+                           data.bid_price,
+                           data.bid_size,
+                           getAskTime(),
+                           data.ask_price,
+                           data.ask_size,
+                           getEventSymbolId(),
+                           data.sequence,
+                           data.time_nanos,
+                           data.bid_exchange_code,
+                           data.ask_exchange_code,
+                           data.scope};
+    }
+};
+
 } // namespace dxfcpp
\ No newline at end of file
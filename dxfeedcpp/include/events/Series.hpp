@@ -8,6 +8,8 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <utility>
 
@@ -15,27 +17,142 @@ extern "C" {
 
 #include "converters/DateTimeConverter.hpp"
 
+#include "utils/Utils.hpp"
+
 #include "Event.hpp"
 #include "EventFlags.hpp"
 #include "EventTraits.hpp"
 
 namespace dxfcpp {
 
+/**
+ * Series event is a snapshot of computed values that are available for all option series for a given underlying
+ * symbol based on the option prices on the market.
+ */
 struct Series final : public MarketEvent, public Indexed {
     /// The alias to a type of shared pointer to the Series object
     using Ptr = std::shared_ptr<Series>;
 
+    /// The alias to a type of intrusive handle to the Series object
+    using Handle = IntrusivePtr<Series>;
+
   private:
     /// Transactional event flags
     EventFlagsMask eventFlags_{};
+    /// Unique per-symbol index of this series
+    std::uint64_t index_{};
+    /// Timestamp of this event in milliseconds
+    std::uint64_t time_{};
+    /// Sequence number of this event to distinguish events that have the same #time_
+    std::int32_t sequence_{};
+    /// Day id of expiration
+    std::int32_t expiration_{};
+    /// Implied volatility index for this series based on VIX methodology
+    double volatility_{std::numeric_limits<double>::quiet_NaN()};
+    /// Call options traded volume for a day
+    double callVolume_{std::numeric_limits<double>::quiet_NaN()};
+    /// Put options traded volume for a day
+    double putVolume_{std::numeric_limits<double>::quiet_NaN()};
+    /// Options traded volume for a day
+    double optionVolume_{std::numeric_limits<double>::quiet_NaN()};
+    /// Ratio of put options traded volume to call options traded volume for a day
+    double putCallRatio_{std::numeric_limits<double>::quiet_NaN()};
+    /// Implied forward price for this option series
+    double forwardPrice_{std::numeric_limits<double>::quiet_NaN()};
+    /// Implied simple dividend return of the corresponding option series
+    double dividend_{std::numeric_limits<double>::quiet_NaN()};
+    /// Implied simple interest return of the corresponding option series
+    double interest_{std::numeric_limits<double>::quiet_NaN()};
 
   public:
-    std::string toString() const override { return std::string(); }
+    /**
+     * Creates new series event with the specified event symbol
+     *
+     * @param eventSymbol The event symbol
+     */
+    explicit Series(const std::string &eventSymbol) : MarketEvent(eventSymbol, EventTraits<Series>::cApiEventId) {}
+
+    /**
+     * Creates new series event with the specified event symbol and dxFeed C-API dxf_series_t
+     *
+     * @param eventSymbol The event symbol
+     * @param series The dxFeed C-API dxf_series_t object
+     */
+    Series(const std::string &eventSymbol, const dxf_series_t &series)
+        : Series(SymbolTable::getInstance().intern(eventSymbol), series) {}
+
+    /**
+     * Creates new series event with the specified event symbol id and dxFeed C-API dxf_series_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param series The dxFeed C-API dxf_series_t object
+     */
+    Series(SymbolTable::IdType eventSymbolId, const dxf_series_t &series)
+        : MarketEvent(eventSymbolId, EventTraits<Series>::cApiEventId), eventFlags_(series.event_flags),
+          index_{static_cast<std::uint64_t>(series.index)}, time_{static_cast<std::uint64_t>(series.time)},
+          sequence_{series.sequence}, expiration_{series.expiration}, volatility_{series.volatility},
+          callVolume_{series.call_volume}, putVolume_{series.put_volume}, optionVolume_{series.option_volume},
+          putCallRatio_{series.put_call_ratio}, forwardPrice_{series.forward_price}, dividend_{series.dividend},
+          interest_{series.interest} {}
+
+    Series &operator=(const Series &other) = delete;
+
+    Series &operator=(Series &&other) = delete;
+
     const IndexedEventSource &getSource() const override { return IndexedEventSource::DEFAULT; }
+
     const EventFlagsMask &getEventFlags() const override { return eventFlags_; }
-    void setEventFlags(const EventFlagsMask &mask) override {}
-    uint64_t getIndex() const override { return 0; }
-    void setIndex(std::uint64_t uint64) override {}
+
+    void setEventFlags(const EventFlagsMask &mask) override { eventFlags_ = mask; }
+
+    std::uint64_t getIndex() const override { return index_; }
+
+    void setIndex(std::uint64_t index) override { index_ = index; }
+
+    /// Returns timestamp of this event in milliseconds
+    std::uint64_t getTime() const { return time_; }
+
+    /// Returns the sequence number of this event (to distinguish events that have the same time)
+    std::int32_t getSequence() const { return sequence_; }
+
+    /// Returns the day id of expiration
+    std::int32_t getExpiration() const { return expiration_; }
+
+    /// Returns implied volatility index for this series based on VIX methodology
+    double getVolatility() const { return volatility_; }
+
+    /// Returns call options traded volume for a day
+    double getCallVolume() const { return callVolume_; }
+
+    /// Returns put options traded volume for a day
+    double getPutVolume() const { return putVolume_; }
+
+    /// Returns options traded volume for a day
+    double getOptionVolume() const { return optionVolume_; }
+
+    /// Returns ratio of put options traded volume to call options traded volume for a day
+    double getPutCallRatio() const { return putCallRatio_; }
+
+    /// Returns implied forward price for this option series
+    double getForwardPrice() const { return forwardPrice_; }
+
+    /// Returns implied simple dividend return of the corresponding option series
+    double getDividend() const { return dividend_; }
+
+    /// Returns implied simple interest return of the corresponding option series
+    double getInterest() const { return interest_; }
+
+    /// Returns a string representation of the entity
+    std::string toString() const override {
+        return "Series{" + getEventSymbol() + ", eventTime=" + DateTimeConverter::toISO(getEventTime()) +
+            ", eventFlags=" + eventFlags_.toString() + ", index=" + string::toHex(index_) +
+            ", time=" + DateTimeConverter::toISO(time_) + ", sequence=" + std::to_string(sequence_) +
+            ", expiration=" + std::to_string(day_util::getYearMonthDayByDayId(expiration_)) +
+            ", volatility=" + std::to_string(volatility_) + ", callVolume=" + std::to_string(callVolume_) +
+            ", putVolume=" + std::to_string(putVolume_) + ", optionVolume=" + std::to_string(optionVolume_) +
+            ", putCallRatio=" + std::to_string(putCallRatio_) + ", forwardPrice=" + std::to_string(forwardPrice_) +
+            ", dividend=" + std::to_string(dividend_) + ", interest=" + std::to_string(interest_) + '}';
+    }
 };
 
-} // namespace dxfcpp
\ No newline at end of file
+} // namespace dxfcpp
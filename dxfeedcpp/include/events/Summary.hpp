@@ -8,7 +8,9 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "common/DXFCppConfig.hpp"
@@ -22,10 +24,44 @@ extern "C" {
 
 namespace dxfcpp {
 
+/**
+ * The compact trivially copyable record of the Summary fields: the symbol is stored as the SymbolTable id, the exchange
+ * code, the price types and the scope are stored as the C-API codes, and the fields are ordered by size (96 bytes on
+ * the most platforms). The records can be kept by value in flat arrays and can be copied by memcpy.
+ * Summary::toRecord() creates the record, Summary(const SummaryRecord &) restores the event.
+ */
+struct SummaryRecord {
+    std::uint64_t eventTime;
+    double dayOpenPrice;
+    double dayHighPrice;
+    double dayLowPrice;
+    double dayClosePrice;
+    double prevDayClosePrice;
+    double prevDayVolume;
+    double openInterest;
+    SymbolTable::IdType eventSymbolId;
+    std::int32_t dayId;
+    std::int32_t prevDayId;
+    std::uint32_t rawFlags;
+    dxf_char_t exchangeCode;
+    dxf_price_type_t dayClosePriceType;
+    dxf_price_type_t prevDayClosePriceType;
+    dxf_order_scope_t scope;
+};
+
+static_assert(std::is_trivially_copyable<SummaryRecord>::value, "SummaryRecord must be trivially copyable");
+static_assert(sizeof(SummaryRecord) <= 128, "SummaryRecord must fit in two cache lines");
+
 struct Summary final : public MarketEvent, public Lasting {
     /// The alias to a type of shared pointer to the Summary object
     using Ptr = std::shared_ptr<Summary>;
 
+    /// The alias to a type of intrusive handle to the Summary object
+    using Handle = IntrusivePtr<Summary>;
+
+    /// The alias to a type of the compact record of the Summary fields
+    using Record = SummaryRecord;
+
     /// Identifier of the day that this summary represents. Identifier of the day is the number of days passed since
     /// January 1, 1970.
     std::int32_t dayId_{};
@@ -68,21 +104,23 @@ struct Summary final : public MarketEvent, public Lasting {
      */
     std::uint32_t rawFlags_{};
 
-    /// Exchange code
-    char exchangeCode_;
+    /// Exchange code (the C-API value, it is converted by the getter)
+    dxf_char_t exchangeCode_;
 
-    /// The price type of the last (close) price for the day
-    PriceType dayClosePriceType_;
+    /// The price type of the last (close) price for the day (the C-API value, it is converted by the getter)
+    dxf_price_type_t dayClosePriceType_;
 
-    /// The price type of the last (close) price for the previous day
-    PriceType prevDayClosePriceType_;
+    /// The price type of the last (close) price for the previous day (the C-API value, it is converted by the getter)
+    dxf_price_type_t prevDayClosePriceType_;
 
     /**
      * Scope of this summary.
      *
      * Possible values: OrderScope#COMPOSITE (Summary events) , OrderScope#REGIONAL (Summary& events)
+     *
+     * The C-API value, it is converted by the getter.
      */
-    OrderScope scope_;
+    dxf_order_scope_t scope_;
 
   public:
     /**
@@ -91,16 +129,40 @@ struct Summary final : public MarketEvent, public Lasting {
      * @param eventSymbol The event symbol
      * @param summary The dxFeed C-API dxf_summary_t object
      */
-    Summary(std::string eventSymbol, const dxf_summary_t &summary)
-        : MarketEvent(std::move(eventSymbol)), dayId_{summary.day_id}, dayOpenPrice_{summary.day_open_price},
-          dayHighPrice_{summary.day_high_price}, dayLowPrice_{summary.day_low_price},
+    Summary(const std::string &eventSymbol, const dxf_summary_t &summary)
+        : Summary(SymbolTable::getInstance().intern(eventSymbol), summary) {}
+
+    /**
+     * Creates new summary event with the specified event symbol id and dxFeed C-API dxf_summary_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param summary The dxFeed C-API dxf_summary_t object
+     */
+    Summary(SymbolTable::IdType eventSymbolId, const dxf_summary_t &summary)
+        : MarketEvent(eventSymbolId, EventTraits<Summary>::cApiEventId), dayId_{summary.day_id},
+          dayOpenPrice_{summary.day_open_price}, dayHighPrice_{summary.day_high_price},
+          dayLowPrice_{summary.day_low_price},
           dayClosePrice_{summary.day_close_price}, prevDayId_{summary.prev_day_id},
           prevDayClosePrice_{summary.prev_day_close_price}, prevDayVolume_{summary.prev_day_volume},
           openInterest_{summary.open_interest}, rawFlags_{static_cast<std::uint32_t>(summary.raw_flags)},
-          exchangeCode_{StringConverter::wCharToUtf8(summary.exchange_code)}, dayClosePriceType_{PriceType::get(
-                                                                                  summary.day_close_price_type)},
-          prevDayClosePriceType_{PriceType::get(summary.prev_day_close_price_type)}, scope_{OrderScope::get(
-                                                                                         summary.scope)} {}
+          exchangeCode_{summary.exchange_code}, dayClosePriceType_{summary.day_close_price_type},
+          prevDayClosePriceType_{summary.prev_day_close_price_type}, scope_{summary.scope} {}
+
+    /**
+     * Creates new summary event with the fields of the record
+     *
+     * @param record The record
+     */
+    explicit Summary(const SummaryRecord &record)
+        : MarketEvent(record.eventSymbolId, EventTraits<Summary>::cApiEventId), dayId_{record.dayId},
+          dayOpenPrice_{record.dayOpenPrice}, dayHighPrice_{record.dayHighPrice}, dayLowPrice_{record.dayLowPrice},
+          dayClosePrice_{record.dayClosePrice}, prevDayId_{record.prevDayId},
+          prevDayClosePrice_{record.prevDayClosePrice}, prevDayVolume_{record.prevDayVolume},
+          openInterest_{record.openInterest}, rawFlags_{record.rawFlags}, exchangeCode_{record.exchangeCode},
+          dayClosePriceType_{record.dayClosePriceType}, prevDayClosePriceType_{record.prevDayClosePriceType},
+          scope_{record.scope} {
+        MarketEvent::setEventTime(record.eventTime);
+    }
 
     Summary &operator=(const Summary &other) = delete;
 
@@ -139,20 +201,40 @@ struct Summary final : public MarketEvent, public Lasting {
     uint32_t getRawFlags() const { return rawFlags_; }
 
     /// Returns the summary's exchange code
-    char getExchangeCode() const { return exchangeCode_; }
+    char getExchangeCode() const { return StringConverter::wCharToUtf8(exchangeCode_); }
 
     /// Returns the price type of the last (close) price for the day
-    const PriceType &getDayClosePriceType() const { return dayClosePriceType_; }
+    PriceType getDayClosePriceType() const { return PriceType::get(dayClosePriceType_); }
 
     /// Returns the price type of the last (close) price for the previous day
-    const PriceType &getPrevDayClosePriceType() const { return prevDayClosePriceType_; }
+    PriceType getPrevDayClosePriceType() const { return PriceType::get(prevDayClosePriceType_); }
 
     /**
      * Returns the scope of this summary.
      *
      * Possible values: OrderScope#COMPOSITE (Summary events) , OrderScope#REGIONAL (Summary& events)
      */
-    const OrderScope &getScope() const { return scope_; }
+    OrderScope getScope() const { return OrderScope::get(scope_); }
+
+    /// Returns the compact record of the fields of this summary
+    SummaryRecord toRecord() const {
+        return SummaryRecord{getEventTime(),
+                             dayOpenPrice_,
+                             dayHighPrice_,
+                             dayLowPrice_,
+                             dayClosePrice_,
+                             prevDayClosePrice_,
+                             prevDayVolume_,
+                             openInterest_,
+                             getEventSymbolId(),
+                             dayId_,
+                             prevDayId_,
+                             rawFlags_,
+                             exchangeCode_,
+                             dayClosePriceType_,
+                             prevDayClosePriceType_,
+                             scope_};
+    }
 
     /// Returns a string representation of the entity
     std::string toString() const override {
@@ -160,13 +242,13 @@ struct Summary final : public MarketEvent, public Lasting {
             ", day=" + std::to_string(day_util::getYearMonthDayByDayId(dayId_)) +
             ", dayOpen=" + std::to_string(dayOpenPrice_) + ", dayHigh=" + std::to_string(dayHighPrice_) +
             ", dayLow=" + std::to_string(dayLowPrice_) + ", dayClose=" + std::to_string(dayClosePrice_) +
-            ", dayCloseType=" + dayClosePriceType_.toString() +
+            ", dayCloseType=" + getDayClosePriceType().toString() +
             ", prevDay=" + std::to_string(day_util::getYearMonthDayByDayId(prevDayId_)) +
             ", prevDayClose=" + std::to_string(prevDayClosePrice_) +
-            ", prevDayCloseType=" + prevDayClosePriceType_.toString() +
+            ", prevDayCloseType=" + getPrevDayClosePriceType().toString() +
             ", prevDayVolume=" + std::to_string(prevDayVolume_) + ", openInterest=" + std::to_string(openInterest_) +
-            ", rawFlags=" + string::toHex(rawFlags_) + ", exchange=" + exchangeCodeToString(exchangeCode_) +
-            ", scope=" + scope_.toString() + '}';
+            ", rawFlags=" + string::toHex(rawFlags_) + ", exchange=" + exchangeCodeToString(getExchangeCode()) +
+            ", scope=" + getScope().toString() + '}';
     }
 };
 
@@ -8,6 +8,8 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <utility>
 
@@ -15,28 +17,124 @@ extern "C" {
 
 #include "converters/DateTimeConverter.hpp"
 
+#include "utils/Utils.hpp"
+
 #include "Event.hpp"
 #include "EventFlags.hpp"
 #include "EventTraits.hpp"
 
 namespace dxfcpp {
 
+/**
+ * Theo price is a snapshot of the theoretical option price computation that is periodically performed by the dxPrice
+ * model-free computation.
+ */
 struct TheoPrice final : public MarketEvent, public TimeSeries, public Lasting {
     /// The alias to a type of shared pointer to the TheoPrice object
     using Ptr = std::shared_ptr<TheoPrice>;
 
+    /// The alias to a type of intrusive handle to the TheoPrice object
+    using Handle = IntrusivePtr<TheoPrice>;
+
   private:
     /// Transactional event flags
     EventFlagsMask eventFlags_{};
+    /// Unique per-symbol index of this event (the C-API does not provide it, so it is composed of the #time_)
+    std::uint64_t index_{};
+    /// Timestamp of this event in milliseconds
+    std::uint64_t time_{};
+    /// Theoretical option price
+    double price_{std::numeric_limits<double>::quiet_NaN()};
+    /// Underlying price at the time of theo price computation
+    double underlyingPrice_{std::numeric_limits<double>::quiet_NaN()};
+    /// Delta of the theoretical price
+    double delta_{std::numeric_limits<double>::quiet_NaN()};
+    /// Gamma of the theoretical price
+    double gamma_{std::numeric_limits<double>::quiet_NaN()};
+    /// Implied simple dividend return of the corresponding option series
+    double dividend_{std::numeric_limits<double>::quiet_NaN()};
+    /// Implied simple interest return of the corresponding option series
+    double interest_{std::numeric_limits<double>::quiet_NaN()};
+
+    // The index has the seconds in the high 32 bits and the milliseconds in bits 22..31 (as the Java API does)
+    static std::uint64_t timeToIndex(std::uint64_t time) {
+        return ((time / 1000) << 32) | ((time % 1000) << 22);
+    }
 
   public:
-    std::string toString() const override { return std::string(); }
+    /**
+     * Creates new theo price event with the specified event symbol
+     *
+     * @param eventSymbol The event symbol
+     */
+    explicit TheoPrice(const std::string &eventSymbol)
+        : MarketEvent(eventSymbol, EventTraits<TheoPrice>::cApiEventId) {}
+
+    /**
+     * Creates new theo price event with the specified event symbol and dxFeed C-API dxf_theo_price_t
+     *
+     * @param eventSymbol The event symbol
+     * @param theoPrice The dxFeed C-API dxf_theo_price_t object
+     */
+    TheoPrice(const std::string &eventSymbol, const dxf_theo_price_t &theoPrice)
+        : TheoPrice(SymbolTable::getInstance().intern(eventSymbol), theoPrice) {}
+
+    /**
+     * Creates new theo price event with the specified event symbol id and dxFeed C-API dxf_theo_price_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param theoPrice The dxFeed C-API dxf_theo_price_t object
+     */
+    TheoPrice(SymbolTable::IdType eventSymbolId, const dxf_theo_price_t &theoPrice)
+        : MarketEvent(eventSymbolId, EventTraits<TheoPrice>::cApiEventId),
+          index_{timeToIndex(static_cast<std::uint64_t>(theoPrice.time))},
+          time_{static_cast<std::uint64_t>(theoPrice.time)}, price_{theoPrice.price},
+          underlyingPrice_{theoPrice.underlying_price}, delta_{theoPrice.delta}, gamma_{theoPrice.gamma},
+          dividend_{theoPrice.dividend}, interest_{theoPrice.interest} {}
+
+    TheoPrice &operator=(const TheoPrice &other) = delete;
+
+    TheoPrice &operator=(TheoPrice &&other) = delete;
+
     const IndexedEventSource &getSource() const override { return IndexedEventSource::DEFAULT; }
+
     const EventFlagsMask &getEventFlags() const override { return eventFlags_; }
-    void setEventFlags(const EventFlagsMask &mask) override {}
-    uint64_t getIndex() const override { return 0; }
-    void setIndex(std::uint64_t uint64) override {}
-    uint64_t getTime() const override { return 0; }
+
+    void setEventFlags(const EventFlagsMask &mask) override { eventFlags_ = mask; }
+
+    std::uint64_t getIndex() const override { return index_; }
+
+    void setIndex(std::uint64_t index) override { index_ = index; }
+
+    std::uint64_t getTime() const override { return time_; }
+
+    /// Returns theoretical option price
+    double getPrice() const { return price_; }
+
+    /// Returns underlying price at the time of theo price computation
+    double getUnderlyingPrice() const { return underlyingPrice_; }
+
+    /// Returns delta of the theoretical price
+    double getDelta() const { return delta_; }
+
+    /// Returns gamma of the theoretical price
+    double getGamma() const { return gamma_; }
+
+    /// Returns implied simple dividend return of the corresponding option series
+    double getDividend() const { return dividend_; }
+
+    /// Returns implied simple interest return of the corresponding option series
+    double getInterest() const { return interest_; }
+
+    /// Returns a string representation of the entity
+    std::string toString() const override {
+        return "TheoPrice{" + getEventSymbol() + ", eventTime=" + DateTimeConverter::toISO(getEventTime()) +
+            ", eventFlags=" + eventFlags_.toString() + ", time=" + DateTimeConverter::toISO(time_) +
+            ", index=" + string::toHex(index_) + ", price=" + std::to_string(price_) +
+            ", underlyingPrice=" + std::to_string(underlyingPrice_) + ", delta=" + std::to_string(delta_) +
+            ", gamma=" + std::to_string(gamma_) + ", dividend=" + std::to_string(dividend_) +
+            ", interest=" + std::to_string(interest_) + '}';
+    }
 };
 
-} // namespace dxfcpp
\ No newline at end of file
+} // namespace dxfcpp
@@ -8,35 +8,191 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <utility>
 
 #include "common/DXFCppConfig.hpp"
 
 #include "converters/DateTimeConverter.hpp"
+#include "converters/StringConverter.hpp"
+
+#include "utils/Utils.hpp"
 
 #include "Event.hpp"
 #include "EventFlags.hpp"
 #include "EventTraits.hpp"
+#include "OrderScope.hpp"
 
 namespace dxfcpp {
 
+/**
+ * Time and Sale represents a trade or other market event with price, like market open/close price, etc.
+ * Time and Sales are intended to provide information about trades in a continuous time slice (unlike Trade events
+ * which are supposed to provide snapshot about the current last trade).
+ */
 struct TimeAndSale final : public MarketEvent, public TimeSeries {
     /// The alias to a type of shared pointer to the TimeAndSale object
     using Ptr = std::shared_ptr<TimeAndSale>;
 
+    /// The alias to a type of intrusive handle to the TimeAndSale object
+    using Handle = IntrusivePtr<TimeAndSale>;
+
   private:
     /// Transactional event flags
     EventFlagsMask eventFlags_{};
+    /// Unique per-symbol index of this time and sale event
+    std::uint64_t index_{};
+    /// Timestamp of the original event
+    std::uint64_t time_{};
+    /// Price of this time and sale event
+    double price_{std::numeric_limits<double>::quiet_NaN()};
+    /// Size of this time and sale event
+    double size_{std::numeric_limits<double>::quiet_NaN()};
+    /// The current bid price on the market when this time and sale event had occurred
+    double bidPrice_{std::numeric_limits<double>::quiet_NaN()};
+    /// The current ask price on the market when this time and sale event had occurred
+    double askPrice_{std::numeric_limits<double>::quiet_NaN()};
+    /// The sale conditions provided for this event by data feed
+    std::string exchangeSaleConditions_{};
+    /// The buyer of this time and sale event
+    std::string buyer_{};
+    /// The seller of this time and sale event
+    std::string seller_{};
+    /// The raw flags of this time and sale event
+    std::uint32_t rawFlags_{};
+    /// Exchange code of this time and sale event (the C-API value, it is converted by the getter)
+    dxf_char_t exchangeCode_{};
+    /// TradeThroughExempt flag of this time and sale event (the C-API value, it is converted by the getter)
+    dxf_char_t tradeThroughExempt_{};
+    /// The aggressor side of this time and sale event (the C-API value)
+    dxf_order_side_t side_{};
+    /// The type of this time and sale event (the C-API value)
+    dxf_tns_type_t type_{};
+    /// Scope of this time and sale event (the C-API value, it is converted by the getter)
+    dxf_order_scope_t scope_{};
+    /// Whether this event represents a valid intraday tick
+    bool isValidTick_{};
+    /// Whether this event represents an extended trading hours sale
+    bool isETHTrade_{};
+    /// Whether this event represents a spread leg
+    bool isSpreadLeg_{};
 
   public:
-    std::string toString() const override { return std::string(); }
+    /**
+     * Creates new time and sale event with the specified event symbol
+     *
+     * @param eventSymbol The event symbol
+     */
+    explicit TimeAndSale(const std::string &eventSymbol)
+        : MarketEvent(eventSymbol, EventTraits<TimeAndSale>::cApiEventId) {}
+
+    /**
+     * Creates new time and sale event with the specified event symbol and dxFeed C-API dxf_time_and_sale_t
+     *
+     * @param eventSymbol The event symbol
+     * @param timeAndSale The dxFeed C-API dxf_time_and_sale_t object
+     */
+    TimeAndSale(const std::string &eventSymbol, const dxf_time_and_sale_t &timeAndSale)
+        : TimeAndSale(SymbolTable::getInstance().intern(eventSymbol), timeAndSale) {}
+
+    /**
+     * Creates new time and sale event with the specified event symbol id and dxFeed C-API dxf_time_and_sale_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param timeAndSale The dxFeed C-API dxf_time_and_sale_t object
+     */
+    TimeAndSale(SymbolTable::IdType eventSymbolId, const dxf_time_and_sale_t &timeAndSale)
+        : MarketEvent(eventSymbolId, EventTraits<TimeAndSale>::cApiEventId), eventFlags_(timeAndSale.event_flags),
+          index_{static_cast<std::uint64_t>(timeAndSale.index)}, time_{static_cast<std::uint64_t>(timeAndSale.time)},
+          price_{timeAndSale.price}, size_{timeAndSale.size}, bidPrice_{timeAndSale.bid_price},
+          askPrice_{timeAndSale.ask_price},
+          exchangeSaleConditions_{StringConverter::wStringToUtf8(timeAndSale.exchange_sale_conditions)},
+          buyer_{StringConverter::wStringToUtf8(timeAndSale.buyer)},
+          seller_{StringConverter::wStringToUtf8(timeAndSale.seller)},
+          rawFlags_{static_cast<std::uint32_t>(timeAndSale.raw_flags)}, exchangeCode_{timeAndSale.exchange_code},
+          tradeThroughExempt_{timeAndSale.trade_through_exempt}, side_{timeAndSale.side}, type_{timeAndSale.type},
+          scope_{timeAndSale.scope}, isValidTick_{timeAndSale.is_valid_tick != 0},
+          isETHTrade_{timeAndSale.is_eth_trade != 0}, isSpreadLeg_{timeAndSale.is_spread_leg != 0} {}
+
+    TimeAndSale &operator=(const TimeAndSale &other) = delete;
+
+    TimeAndSale &operator=(TimeAndSale &&other) = delete;
+
     const IndexedEventSource &getSource() const override { return IndexedEventSource::DEFAULT; }
+
     const EventFlagsMask &getEventFlags() const override { return eventFlags_; }
-    void setEventFlags(const EventFlagsMask &mask) override {}
-    uint64_t getIndex() const override { return 0; }
-    void setIndex(std::uint64_t uint64) override {}
-    uint64_t getTime() const override { return 0; }
+
+    void setEventFlags(const EventFlagsMask &mask) override { eventFlags_ = mask; }
+
+    std::uint64_t getIndex() const override { return index_; }
+
+    void setIndex(std::uint64_t index) override { index_ = index; }
+
+    std::uint64_t getTime() const override { return time_; }
+
+    /// Returns exchange code of this time and sale event
+    char getExchangeCode() const { return StringConverter::wCharToUtf8(exchangeCode_); }
+
+    /// Returns price of this time and sale event
+    double getPrice() const { return price_; }
+
+    /// Returns size of this time and sale event
+    double getSize() const { return size_; }
+
+    /// Returns the current bid price on the market when this time and sale event had occurred
+    double getBidPrice() const { return bidPrice_; }
+
+    /// Returns the current ask price on the market when this time and sale event had occurred
+    double getAskPrice() const { return askPrice_; }
+
+    /// Returns sale conditions provided for this event by data feed
+    const std::string &getExchangeSaleConditions() const { return exchangeSaleConditions_; }
+
+    /// Returns the raw flags of this time and sale event
+    std::uint32_t getRawFlags() const { return rawFlags_; }
+
+    /// Returns the buyer of this time and sale event
+    const std::string &getBuyer() const { return buyer_; }
+
+    /// Returns the seller of this time and sale event
+    const std::string &getSeller() const { return seller_; }
+
+    /// Returns the aggressor side of this time and sale event (the C-API value)
+    dxf_order_side_t getAggressorSide() const { return side_; }
+
+    /// Returns the type of this time and sale event (the C-API value)
+    dxf_tns_type_t getType() const { return type_; }
+
+    /// Returns whether this event represents a valid intraday tick
+    bool isValidTick() const { return isValidTick_; }
+
+    /// Returns whether this event represents an extended trading hours sale
+    bool isExtendedTradingHours() const { return isETHTrade_; }
+
+    /// Returns TradeThroughExempt flag of this time and sale event
+    char getTradeThroughExempt() const { return StringConverter::wCharToUtf8(tradeThroughExempt_); }
+
+    /// Returns whether this event represents a spread leg
+    bool isSpreadLeg() const { return isSpreadLeg_; }
+
+    /// Returns scope of this time and sale event
+    OrderScope getScope() const { return OrderScope::get(scope_); }
+
+    /// Returns a string representation of the entity
+    std::string toString() const override {
+        return "TimeAndSale{" + getEventSymbol() + ", eventTime=" + DateTimeConverter::toISO(getEventTime()) +
+            ", eventFlags=" + eventFlags_.toString() + ", time=" + DateTimeConverter::toISO(time_) +
+            ", index=" + string::toHex(index_) + ", exchange=" + exchangeCodeToString(getExchangeCode()) +
+            ", price=" + std::to_string(price_) + ", size=" + std::to_string(size_) +
+            ", bid=" + std::to_string(bidPrice_) + ", ask=" + std::to_string(askPrice_) +
+            ", ESC='" + getExchangeSaleConditions() + "', TTE=" + exchangeCodeToString(getTradeThroughExempt()) +
+            ", side=" + std::to_string(side_) + ", spread=" + (isSpreadLeg_ ? "true" : "false") +
+            ", ETH=" + (isETHTrade_ ? "true" : "false") + ", validTick=" + (isValidTick_ ? "true" : "false") +
+            ", type=" + std::to_string(type_) + ", buyer='" + getBuyer() + "', seller='" + getSeller() +
+            "', rawFlags=" + string::toHex(rawFlags_) + ", scope=" + getScope().toString() + '}';
+    }
 };
 
-} // namespace dxfcpp
\ No newline at end of file
+} // namespace dxfcpp
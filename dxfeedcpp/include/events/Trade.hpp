@@ -9,7 +9,9 @@ extern "C" {
 }
 
 #include <cmath>
+#include <cstdint>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "common/DXFCppConfig.hpp"
@@ -23,9 +25,40 @@ extern "C" {
 #include "Event.hpp"
 #include "EventFlags.hpp"
 #include "EventTraits.hpp"
+#include "EventView.hpp"
 
 namespace dxfcpp {
 
+/**
+ * The compact trivially copyable record of the Trade and TradeETH fields: the symbol is stored as the SymbolTable id,
+ * the exchange code, the direction and the scope are stored as the C-API codes, and the fields are ordered by size
+ * (96 bytes on the most platforms). The records can be kept by value in flat arrays and can be copied by memcpy.
+ * TradeBase::toRecord() and BasicTradeView::toRecord() create the record, Trade(const TradeRecord &) and
+ * TradeETH(const TradeRecord &) restore the event.
+ */
+struct TradeRecord {
+    std::uint64_t eventTime;
+    std::uint64_t time;
+    double price;
+    double size;
+    double change;
+    double dayVolume;
+    double dayTurnover;
+    SymbolTable::IdType eventSymbolId;
+    std::int32_t sequence;
+    std::int32_t timeNanoPart;
+    std::int32_t tick;
+    std::int32_t dayId;
+    std::uint32_t rawFlags;
+    dxf_char_t exchangeCode;
+    dxf_direction_t direction;
+    dxf_order_scope_t scope;
+    bool isEth;
+};
+
+static_assert(std::is_trivially_copyable<TradeRecord>::value, "TradeRecord must be trivially copyable");
+static_assert(sizeof(TradeRecord) <= 128, "TradeRecord must fit in two cache lines");
+
 /**
  * Base class for common fields of #Trade and #TradeETH events.
  * Trade events represent the most recent information that is available about the last trade on the market
@@ -35,6 +68,12 @@ struct TradeBase : public MarketEvent, public Lasting {
     /// The alias to a type of shared pointer to the TradeBase object
     using Ptr = std::shared_ptr<TradeBase>;
 
+    /// The alias to a type of intrusive handle to the TradeBase object
+    using Handle = IntrusivePtr<TradeBase>;
+
+    /// The alias to a type of the compact record of the trade fields
+    using Record = TradeRecord;
+
   private:
     /// Time of the last trade.
     std::uint64_t time_{};
@@ -45,8 +84,8 @@ struct TradeBase : public MarketEvent, public Lasting {
     /// Microseconds and nanoseconds part of time of the last trade
     std::int32_t timeNanoPart_{};
 
-    /// Exchange code of the last trade
-    char exchangeCode_{};
+    /// Exchange code of the last trade (the C-API value, it is converted by the getter)
+    dxf_char_t exchangeCode_{};
 
     /// Price of the last trade
     double price_{std::numeric_limits<double>::quiet_NaN()};
@@ -92,8 +131,8 @@ struct TradeBase : public MarketEvent, public Lasting {
      */
     std::uint32_t rawFlags_{};
 
-    /// Tick direction of the last trade
-    Direction direction_;
+    /// Tick direction of the last trade (the C-API value, it is converted by the getter)
+    dxf_direction_t direction_;
 
     /// Last trade was in extended trading hours
     bool isEth_{};
@@ -102,8 +141,10 @@ struct TradeBase : public MarketEvent, public Lasting {
      * Last trade scope.
      *
      * Possible values: OrderScope::COMPOSITE (Trade events) , OrderScope::REGIONAL (Trade& events)
+     *
+     * The C-API value, it is converted by the getter.
      */
-    OrderScope scope_;
+    dxf_order_scope_t scope_;
 
   public:
     /**
@@ -111,23 +152,61 @@ struct TradeBase : public MarketEvent, public Lasting {
      *
      * @param eventSymbol The event symbol
      * @param trade The dxFeed C-API dxf_trade_t object
+     * @param typeTag The type tag of the event (see Event::getTypeTag)
      */
-    TradeBase(std::string eventSymbol, const dxf_trade_t &trade)
-        : MarketEvent(std::move(eventSymbol)), time_{static_cast<std::uint64_t>(trade.time)}, sequence_{trade.sequence},
-          timeNanoPart_{trade.time_nanos}, exchangeCode_{StringConverter::wCharToUtf8(trade.exchange_code)},
-          price_{trade.price}, size_{trade.size}, tick_{trade.tick}, change_{trade.change}, dayId_{trade.day_id},
-          dayVolume_{trade.day_volume}, dayTurnover_{trade.day_turnover}, rawFlags_{static_cast<std::uint32_t>(
-                                                                              trade.raw_flags)},
-          direction_{Direction::get(trade.direction)}, isEth_{static_cast<bool>(trade.is_eth)}, scope_{OrderScope::get(
-                                                                                                    trade.scope)} {
-        // Tries to infer the value of direction from tick if direction is UNDEFINED.
-        if (direction_ == Direction::UNDEFINED) {
-            if (tick_ == 1) {
-                direction_ = Direction::ZERO_UP;
-            } else if (tick_ == 2) {
-                direction_ = Direction::ZERO_DOWN;
+    TradeBase(const std::string &eventSymbol, const dxf_trade_t &trade, unsigned typeTag = UNKNOWN_TYPE_TAG)
+        : TradeBase(SymbolTable::getInstance().intern(eventSymbol), trade, typeTag) {}
+
+    /**
+     * Creates new trade with the specified event symbol id and dxFeed C-API dxf_trade_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param trade The dxFeed C-API dxf_trade_t object
+     * @param typeTag The type tag of the event (see Event::getTypeTag)
+     */
+    TradeBase(SymbolTable::IdType eventSymbolId, const dxf_trade_t &trade, unsigned typeTag = UNKNOWN_TYPE_TAG)
+        : MarketEvent(eventSymbolId, typeTag), time_{static_cast<std::uint64_t>(trade.time)}, sequence_{trade.sequence},
+          timeNanoPart_{trade.time_nanos}, exchangeCode_{trade.exchange_code}, price_{trade.price},
+          size_{trade.size}, tick_{trade.tick}, change_{trade.change}, dayId_{trade.day_id},
+          dayVolume_{trade.day_volume}, dayTurnover_{trade.day_turnover},
+          rawFlags_{static_cast<std::uint32_t>(trade.raw_flags)}, direction_{trade.direction},
+          isEth_{static_cast<bool>(trade.is_eth)}, scope_{trade.scope} {}
+
+    /**
+     * Creates new trade with the fields of the record
+     *
+     * @param record The record
+     * @param typeTag The type tag of the event (see Event::getTypeTag)
+     */
+    explicit TradeBase(const TradeRecord &record, unsigned typeTag = UNKNOWN_TYPE_TAG)
+        : MarketEvent(record.eventSymbolId, typeTag), time_{record.time}, sequence_{record.sequence},
+          timeNanoPart_{record.timeNanoPart}, exchangeCode_{record.exchangeCode}, price_{record.price},
+          size_{record.size}, tick_{record.tick}, change_{record.change}, dayId_{record.dayId},
+          dayVolume_{record.dayVolume}, dayTurnover_{record.dayTurnover}, rawFlags_{record.rawFlags},
+          direction_{record.direction}, isEth_{record.isEth}, scope_{record.scope} {
+        MarketEvent::setEventTime(record.eventTime);
+    }
+
+    /**
+     * Returns the tick direction of a trade: the C-API direction, or the direction inferred from the tick if the
+     * C-API direction is UNDEFINED
+     *
+     * @param direction The C-API direction
+     * @param tick The trend indicator (1 is Up, 2 is Down)
+     * @return The tick direction
+     */
+    static Direction getDirection(dxf_direction_t direction, std::int32_t tick) {
+        auto result = Direction::get(direction);
+
+        if (result == Direction::UNDEFINED) {
+            if (tick == 1) {
+                return Direction::ZERO_UP;
+            } else if (tick == 2) {
+                return Direction::ZERO_DOWN;
             }
         }
+
+        return result;
     }
 
     TradeBase &operator=(const TradeBase &other) = delete;
@@ -135,8 +214,9 @@ struct TradeBase : public MarketEvent, public Lasting {
     TradeBase &operator=(TradeBase &&other) = delete;
 
     /// Creates new Trade or TradeTH with specified event symbol
-    explicit TradeBase(std::string eventSymbol)
-        : MarketEvent(std::move(eventSymbol)), direction_(Direction::UNDEFINED), scope_(OrderScope::UNKNOWN) {}
+    explicit TradeBase(const std::string &eventSymbol, unsigned typeTag = UNKNOWN_TYPE_TAG)
+        : MarketEvent(eventSymbol, typeTag), direction_(Direction::UNDEFINED.getDirection()),
+          scope_(OrderScope::UNKNOWN.getScope()) {}
     ~TradeBase() override = default;
 
     /// Returns the last trade time
@@ -149,7 +229,7 @@ struct TradeBase : public MarketEvent, public Lasting {
     int32_t getTimeNanoPart() const { return timeNanoPart_; }
 
     /// Returns an exchange code of the last trade
-    char getExchangeCode() const { return exchangeCode_; }
+    char getExchangeCode() const { return StringConverter::wCharToUtf8(exchangeCode_); }
 
     /// Returns a price of the last trade
     double getPrice() const { return price_; }
@@ -177,26 +257,48 @@ struct TradeBase : public MarketEvent, public Lasting {
     std::uint32_t getFlags() const { return rawFlags_; }
 
     /// Returns a tick direction of the last trade
-    const Direction &getDirection() const { return direction_; }
+    Direction getDirection() const { return getDirection(direction_, tick_); }
 
     /// Returns true if the last trade was in extended trading hours
     bool isExtendedTradingHours() const { return isEth_; }
 
     /// Returns the last trade scope.
     /// Possible values: OrderScope::COMPOSITE (Trade events), OrderScope::REGIONAL (Trade& events)
-    const OrderScope &getScope() const { return scope_; }
+    OrderScope getScope() const { return OrderScope::get(scope_); }
+
+    /// Returns the compact record of the fields of this trade
+    TradeRecord toRecord() const {
+        return TradeRecord{getEventTime(),
+                           time_,
+                           price_,
+                           size_,
+                           change_,
+                           dayVolume_,
+                           dayTurnover_,
+                           getEventSymbolId(),
+                           sequence_,
+                           timeNanoPart_,
+                           tick_,
+                           dayId_,
+                           rawFlags_,
+                           exchangeCode_,
+                           direction_,
+                           scope_,
+                           isEth_};
+    }
 
     /// Returns a string representation of the base fields
     std::string baseFieldsToString() const {
         return std::string() + getEventSymbol() + ", eventTime=" + DateTimeConverter::toISO(getEventTime()) +
             ", time=" + DateTimeConverter::toISO(time_) + ", sequence=" + std::to_string(sequence_) +
-            ", timeNanoPart=" + std::to_string(timeNanoPart_) + ", exchange=" + exchangeCodeToString(exchangeCode_) +
-            ", price=" + std::to_string(price_) + ", size=" + std::to_string(size_) +
+            ", timeNanoPart=" + std::to_string(timeNanoPart_) +
+            ", exchange=" + exchangeCodeToString(getExchangeCode()) + ", price=" + std::to_string(price_) +
+            ", size=" + std::to_string(size_) +
             ", tick=" + std::to_string(tick_) + ", change=" + std::to_string(change_) +
             ", day=" + std::to_string(day_util::getYearMonthDayByDayId(dayId_)) +
             ", dayVolume=" + std::to_string(dayVolume_) + ", dayTurnover=" + std::to_string(dayTurnover_) +
-            ", rawFlags=" + string::toHex(rawFlags_) + ", scope=" + scope_.toString() +
-            ", direction=" + direction_.toString() + ", ETH=" + std::to_string(isEth_);
+            ", rawFlags=" + string::toHex(rawFlags_) + ", scope=" + getScope().toString() +
+            ", direction=" + getDirection().toString() + ", ETH=" + std::to_string(isEth_);
     }
 };
 
@@ -210,20 +312,40 @@ struct Trade final : public TradeBase {
     /// The alias to a type of shared pointer to the Trade object
     using Ptr = std::shared_ptr<Trade>;
 
+    /// The alias to a type of intrusive handle to the Trade object
+    using Handle = IntrusivePtr<Trade>;
+
     /**
      * Creates new trade with the specified event symbol and dxFeed C-API dxf_trade_t
      *
      * @param eventSymbol The event symbol
      * @param trade The dxFeed C-API dxf_trade_t object
      */
-    Trade(std::string eventSymbol, const dxf_trade_t &trade) : TradeBase(std::move(eventSymbol), trade) {}
+    Trade(const std::string &eventSymbol, const dxf_trade_t &trade)
+        : TradeBase(eventSymbol, trade, EventTraits<Trade>::cApiEventId) {}
+
+    /**
+     * Creates new trade with the specified event symbol id and dxFeed C-API dxf_trade_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param trade The dxFeed C-API dxf_trade_t object
+     */
+    Trade(SymbolTable::IdType eventSymbolId, const dxf_trade_t &trade)
+        : TradeBase(eventSymbolId, trade, EventTraits<Trade>::cApiEventId) {}
+
+    /**
+     * Creates new trade with the fields of the record
+     *
+     * @param record The record
+     */
+    explicit Trade(const TradeRecord &record) : TradeBase(record, EventTraits<Trade>::cApiEventId) {}
 
     /**
      * Creates new trade with the specified event symbol
      *
      * @param eventSymbol The event symbol
      */
-    explicit Trade(std::string eventSymbol) : TradeBase(std::move(eventSymbol)) {}
+    explicit Trade(const std::string &eventSymbol) : TradeBase(eventSymbol, EventTraits<Trade>::cApiEventId) {}
 
     /// Returns a string representation of the trade
     std::string toString() const override { return std::string("Trade{") + baseFieldsToString() + "}"; }
@@ -241,23 +363,131 @@ struct TradeETH final : public TradeBase {
     /// The alias to a type of shared pointer to the TradeETH object
     using Ptr = std::shared_ptr<TradeETH>;
 
+    /// The alias to a type of intrusive handle to the TradeETH object
+    using Handle = IntrusivePtr<TradeETH>;
+
     /**
      * Creates new trade with the specified event symbol and dxFeed C-API dxf_trade_t
      *
      * @param eventSymbol The event symbol
      * @param trade The dxFeed C-API dxf_trade_t object
      */
-    TradeETH(std::string eventSymbol, const dxf_trade_eth_t &trade) : TradeBase(std::move(eventSymbol), trade) {}
+    TradeETH(const std::string &eventSymbol, const dxf_trade_eth_t &trade)
+        : TradeBase(eventSymbol, trade, EventTraits<TradeETH>::cApiEventId) {}
+
+    /**
+     * Creates new trade with the specified event symbol id and dxFeed C-API dxf_trade_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param trade The dxFeed C-API dxf_trade_t object
+     */
+    TradeETH(SymbolTable::IdType eventSymbolId, const dxf_trade_eth_t &trade)
+        : TradeBase(eventSymbolId, trade, EventTraits<TradeETH>::cApiEventId) {}
+
+    /**
+     * Creates new trade with the fields of the record
+     *
+     * @param record The record
+     */
+    explicit TradeETH(const TradeRecord &record) : TradeBase(record, EventTraits<TradeETH>::cApiEventId) {}
 
     /**
      * Creates new trade with the specified event symbol
      *
      * @param eventSymbol The event symbol
      */
-    explicit TradeETH(std::string eventSymbol) : TradeBase(std::move(eventSymbol)) {}
+    explicit TradeETH(const std::string &eventSymbol)
+        : TradeBase(eventSymbol, EventTraits<TradeETH>::cApiEventId) {}
 
     /// Returns a string representation of the trade
     std::string toString() const override { return std::string("TradeETH{") + baseFieldsToString() + "}"; }
 };
 
+
+/**
+ * The non-owning view of the dxFeed C-API trade with the same getters as TradeBase. It is valid only during the
+ * listener call (see SubscriptionImpl::onView); materialize() creates the Trade or the TradeETH.
+ *
+ * @tparam E The type of the owning event (Trade or TradeETH)
+ */
+template <typename E> struct BasicTradeView final : public EventView<E, dxf_trade_t> {
+    using EventView<E, dxf_trade_t>::EventView;
+
+    /// Returns the last trade time
+    std::uint64_t getTime() const { return static_cast<std::uint64_t>(this->getData().time); }
+
+    /// Returns the sequence number of the last trade (to distinguish trades that have the same time)
+    std::int32_t getSequence() const { return this->getData().sequence; }
+
+    /// Returns microseconds and nanoseconds part of time of the last trade
+    std::int32_t getTimeNanoPart() const { return this->getData().time_nanos; }
+
+    /// Returns an exchange code of the last trade
+    char getExchangeCode() const { return StringConverter::wCharToUtf8(this->getData().exchange_code); }
+
+    /// Returns a price of the last trade
+    double getPrice() const { return this->getData().price; }
+
+    /// Returns a size of the last trade
+    double getSize() const { return this->getData().size; }
+
+    /// Returns the trend indicator – in which direction price is moving. The values are: Up (Tick = 1),
+    /// Down (Tick = 2) and Undefined (Tick = 0).
+    std::int32_t getTick() const { return this->getData().tick; }
+
+    /// Returns a change of the last trade.
+    double getChange() const { return this->getData().change; }
+
+    /// Returns an identifier of the day that this `Trade` or `TradeETH` represents.
+    std::int32_t getDayId() const { return this->getData().day_id; }
+
+    /// Returns a total volume traded for a day
+    double getDayVolume() const { return this->getData().day_volume; }
+
+    /// Returns a total turnover traded for a day
+    double getDayTurnover() const { return this->getData().day_turnover; }
+
+    /// Returns a raw flags of the last trade
+    std::uint32_t getFlags() const { return static_cast<std::uint32_t>(this->getData().raw_flags); }
+
+    /// Returns a tick direction of the last trade (inferred from the tick if the direction is UNDEFINED, as in
+    /// TradeBase)
+    Direction getDirection() const { return TradeBase::getDirection(this->getData().direction, getTick()); }
+
+    /// Returns true if the last trade was in extended trading hours
+    bool isExtendedTradingHours() const { return static_cast<bool>(this->getData().is_eth); }
+
+    /// Returns the last trade scope.
+    OrderScope getScope() const { return OrderScope::get(this->getData().scope); }
+
+    /// Returns the compact record of the fields of the trade (without creating the Trade or the TradeETH)
+    TradeRecord toRecord() const {
+        const auto &data = this->getData();
+
+        return TradeRecord{this->getEventTime(),
+                           getTime(),
+                           data.price,
+                           data.size,
+                           data.change,
+                           data.day_volume,
+                           data.day_turnover,
+                           this->getEventSymbolId(),
+                           data.sequence,
+                           data.time_nanos,
+                           data.tick,
+                           data.day_id,
+                           getFlags(),
+                           data.exchange_code,
+                           data.direction,
+                           data.scope,
+                           isExtendedTradingHours()};
+    }
+};
+
+/// The non-owning view of the dxFeed C-API trade
+using TradeView = BasicTradeView<Trade>;
+
+/// The non-owning view of the dxFeed C-API trade during extended trading hours
+using TradeETHView = BasicTradeView<TradeETH>;
+
 } // namespace dxfcpp
\ No newline at end of file
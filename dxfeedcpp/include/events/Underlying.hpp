@@ -8,6 +8,8 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <utility>
 
@@ -15,28 +17,123 @@ extern "C" {
 
 #include "converters/DateTimeConverter.hpp"
 
+#include "utils/Utils.hpp"
+
 #include "Event.hpp"
 #include "EventFlags.hpp"
 #include "EventTraits.hpp"
 
 namespace dxfcpp {
 
+/**
+ * Underlying event is a snapshot of computed values that are available for an option underlying symbol based on the
+ * option prices on the market.
+ */
 struct Underlying final : public MarketEvent, public TimeSeries, public Lasting {
     /// The alias to a type of shared pointer to the Underlying object
     using Ptr = std::shared_ptr<Underlying>;
 
+    /// The alias to a type of intrusive handle to the Underlying object
+    using Handle = IntrusivePtr<Underlying>;
+
   private:
     /// Transactional event flags
     EventFlagsMask eventFlags_{};
+    /// Unique per-symbol index of this event (the C-API does not provide it)
+    std::uint64_t index_{};
+    /// 30-day implied volatility for this underlying based on VIX methodology
+    double volatility_{std::numeric_limits<double>::quiet_NaN()};
+    /// Front month implied volatility for this underlying based on VIX methodology
+    double frontVolatility_{std::numeric_limits<double>::quiet_NaN()};
+    /// Back month implied volatility for this underlying based on VIX methodology
+    double backVolatility_{std::numeric_limits<double>::quiet_NaN()};
+    /// Call options traded volume for a day
+    double callVolume_{std::numeric_limits<double>::quiet_NaN()};
+    /// Put options traded volume for a day
+    double putVolume_{std::numeric_limits<double>::quiet_NaN()};
+    /// Options traded volume for a day
+    double optionVolume_{std::numeric_limits<double>::quiet_NaN()};
+    /// Ratio of put options traded volume to call options traded volume for a day
+    double putCallRatio_{std::numeric_limits<double>::quiet_NaN()};
 
   public:
-    std::string toString() const override { return std::string(); }
+    /**
+     * Creates new underlying event with the specified event symbol
+     *
+     * @param eventSymbol The event symbol
+     */
+    explicit Underlying(const std::string &eventSymbol)
+        : MarketEvent(eventSymbol, EventTraits<Underlying>::cApiEventId) {}
+
+    /**
+     * Creates new underlying event with the specified event symbol and dxFeed C-API dxf_underlying_t
+     *
+     * @param eventSymbol The event symbol
+     * @param underlying The dxFeed C-API dxf_underlying_t object
+     */
+    Underlying(const std::string &eventSymbol, const dxf_underlying_t &underlying)
+        : Underlying(SymbolTable::getInstance().intern(eventSymbol), underlying) {}
+
+    /**
+     * Creates new underlying event with the specified event symbol id and dxFeed C-API dxf_underlying_t
+     *
+     * @param eventSymbolId The id of the event symbol in the SymbolTable
+     * @param underlying The dxFeed C-API dxf_underlying_t object
+     */
+    Underlying(SymbolTable::IdType eventSymbolId, const dxf_underlying_t &underlying)
+        : MarketEvent(eventSymbolId, EventTraits<Underlying>::cApiEventId), volatility_{underlying.volatility},
+          frontVolatility_{underlying.front_volatility}, backVolatility_{underlying.back_volatility},
+          callVolume_{underlying.call_volume}, putVolume_{underlying.put_volume},
+          optionVolume_{underlying.option_volume}, putCallRatio_{underlying.put_call_ratio} {}
+
+    Underlying &operator=(const Underlying &other) = delete;
+
+    Underlying &operator=(Underlying &&other) = delete;
+
     const IndexedEventSource &getSource() const override { return IndexedEventSource::DEFAULT; }
+
     const EventFlagsMask &getEventFlags() const override { return eventFlags_; }
-    void setEventFlags(const EventFlagsMask &mask) override {}
-    uint64_t getIndex() const override { return 0; }
-    void setIndex(std::uint64_t uint64) override {}
-    uint64_t getTime() const override { return 0; }
+
+    void setEventFlags(const EventFlagsMask &mask) override { eventFlags_ = mask; }
+
+    std::uint64_t getIndex() const override { return index_; }
+
+    void setIndex(std::uint64_t index) override { index_ = index; }
+
+    /// Returns the timestamp of this event (the C-API does not provide it, so it is composed of the index)
+    std::uint64_t getTime() const override { return ((index_ >> 32) * 1000) + ((index_ >> 22) & 0x3ff); }
+
+    /// Returns 30-day implied volatility for this underlying based on VIX methodology
+    double getVolatility() const { return volatility_; }
+
+    /// Returns front month implied volatility for this underlying based on VIX methodology
+    double getFrontVolatility() const { return frontVolatility_; }
+
+    /// Returns back month implied volatility for this underlying based on VIX methodology
+    double getBackVolatility() const { return backVolatility_; }
+
+    /// Returns call options traded volume for a day
+    double getCallVolume() const { return callVolume_; }
+
+    /// Returns put options traded volume for a day
+    double getPutVolume() const { return putVolume_; }
+
+    /// Returns options traded volume for a day
+    double getOptionVolume() const { return optionVolume_; }
+
+    /// Returns ratio of put options traded volume to call options traded volume for a day
+    double getPutCallRatio() const { return putCallRatio_; }
+
+    /// Returns a string representation of the entity
+    std::string toString() const override {
+        return "Underlying{" + getEventSymbol() + ", eventTime=" + DateTimeConverter::toISO(getEventTime()) +
+            ", eventFlags=" + eventFlags_.toString() + ", time=" + DateTimeConverter::toISO(getTime()) +
+            ", index=" + string::toHex(index_) + ", volatility=" + std::to_string(volatility_) +
+            ", frontVolatility=" + std::to_string(frontVolatility_) +
+            ", backVolatility=" + std::to_string(backVolatility_) + ", callVolume=" + std::to_string(callVolume_) +
+            ", putVolume=" + std::to_string(putVolume_) + ", optionVolume=" + std::to_string(optionVolume_) +
+            ", putCallRatio=" + std::to_string(putCallRatio_) + '}';
+    }
 };
 
-} // namespace dxfcpp
\ No newline at end of file
+} // namespace dxfcpp
@@ -0,0 +1,261 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+#include "common/DXFCppConfig.hpp"
+
+#include "ThreadingConfig.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dxfcpp {
+
+/**
+ * A thread-safe dispatcher engine: fixed sets of worker threads that outlive individual tasks and pull work from FIFO
+ * queues.
+ *
+ * The tasks are posted with a priority. Each priority level has its own queue and its own workers, so the tasks of a
+ * higher level (for example, connection status notifications) are never queued behind the tasks of a lower level (for
+ * example, a backlog of market data). The level 0 (HIGHEST_PRIORITY) is the highest one, the last level
+ * (LOWEST_PRIORITY) is the default one.
+ *
+ * Workers of a level are started lazily on the first task of the level, so creating a dispatcher (or a handler that
+ * refers to it) does not create threads, and the levels that are not used do not have threads.
+ * The destructor executes the remaining tasks and joins the workers. If the last reference to the dispatcher is
+ * released by one of its own tasks, the worker of that task is detached instead: it keeps its level (the queue) alive,
+ * drains the remaining tasks of the level and exits.
+ *
+ * The workers apply the dispatcher's ThreadingConfig (names, CPU affinity, scheduling policy) on start.
+ */
+struct Dispatcher final {
+    /// The alias to a type of shared pointer to the Dispatcher object
+    using Ptr = std::shared_ptr<Dispatcher>;
+
+    /// The task type
+    using TaskType = std::function<void()>;
+
+    /// The highest priority level
+    static DXFCPP_USE_CONSTEXPR std::size_t HIGHEST_PRIORITY = 0;
+
+    /// The lowest priority level (any level greater than the number of levels means the lowest one)
+    static DXFCPP_USE_CONSTEXPR std::size_t LOWEST_PRIORITY = std::numeric_limits<std::size_t>::max();
+
+  private:
+    struct Level {
+        const std::size_t priority;
+        const std::size_t threadsCount;
+        // The index of the first worker of the level among all the workers of the dispatcher
+        const std::size_t firstWorkerIndex;
+
+        std::mutex mutex{};
+        std::condition_variable cv{};
+        std::deque<TaskType> tasks{};
+        std::vector<std::thread> workers{};
+        bool stopped{false};
+
+        Level(std::size_t p, std::size_t count, std::size_t first)
+            : priority{p}, threadsCount{count}, firstWorkerIndex{first} {}
+    };
+
+    const ThreadingConfig threadingConfig_;
+    // The levels are shared with their workers: a worker that releases the last reference to the dispatcher from its
+    // own task is detached by the destructor and still reads its level after the task returns.
+    std::vector<std::shared_ptr<Level>> levels_{};
+    std::size_t totalThreadsCount_{};
+
+    static const Dispatcher *&currentDispatcher() {
+        static thread_local const Dispatcher *current = nullptr;
+
+        return current;
+    }
+
+    void initLevels(std::size_t threadsCount) {
+        auto prioritiesCount = std::max(threadingConfig_.prioritiesCount, static_cast<std::size_t>(1));
+        auto priorityThreadsCount = std::max(threadingConfig_.priorityThreadsCount, static_cast<std::size_t>(1));
+
+        threadsCount = std::max(threadsCount, static_cast<std::size_t>(1));
+
+        // The workers of the lowest level go first, so their indices (names, CPUs) do not depend on the levels count.
+        std::vector<std::size_t> firstWorkerIndices(prioritiesCount);
+
+        firstWorkerIndices[prioritiesCount - 1] = 0;
+        totalThreadsCount_ = threadsCount;
+
+        for (std::size_t priority = 0; priority + 1 < prioritiesCount; priority++) {
+            firstWorkerIndices[priority] = totalThreadsCount_;
+            totalThreadsCount_ += priorityThreadsCount;
+        }
+
+        for (std::size_t priority = 0; priority < prioritiesCount; priority++) {
+            levels_.emplace_back(std::make_shared<Level>(
+                priority, priority + 1 == prioritiesCount ? threadsCount : priorityThreadsCount,
+                firstWorkerIndices[priority]));
+        }
+    }
+
+    Level &getLevel(std::size_t priority) const {
+        return *levels_[priority < levels_.size() ? priority : levels_.size() - 1];
+    }
+
+    // The dispatcher (this) can be destroyed by any task, so only the level is used after the first task starts
+    void run(Level &level, std::size_t index) {
+        currentDispatcher() = this;
+
+        auto name = level.priority + 1 == levels_.size()
+                        ? std::to_string(index)
+                        : "p" + std::to_string(level.priority) + "-" + std::to_string(index - level.firstWorkerIndex);
+
+        threadingConfig_.applyToCurrentThread(name, index);
+
+        while (true) {
+            TaskType task{};
+
+            {
+                std::unique_lock<std::mutex> lock{level.mutex};
+
+                level.cv.wait(lock, [&level] { return level.stopped || !level.tasks.empty(); });
+
+                if (level.tasks.empty()) {
+                    break;
+                }
+
+                task = std::move(level.tasks.front());
+                level.tasks.pop_front();
+            }
+
+            task();
+        }
+
+        currentDispatcher() = nullptr;
+    }
+
+    // Must be called under the mutex of the level
+    void startWorkers(Level &level) {
+        if (!level.workers.empty() || level.stopped) {
+            return;
+        }
+
+        level.workers.reserve(level.threadsCount);
+
+        for (std::size_t i = 0; i < level.threadsCount; i++) {
+            auto index = level.firstWorkerIndex + i;
+            auto sharedLevel = levels_[level.priority];
+
+            level.workers.emplace_back([this, sharedLevel, index] { run(*sharedLevel, index); });
+        }
+    }
+
+  public:
+    /// Returns the default number of workers (the number of hardware threads, at least one)
+    static std::size_t getDefaultThreadsCount() {
+        return std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), static_cast<std::size_t>(1));
+    }
+
+    /**
+     * Creates the new dispatcher with the specified number of workers of the lowest priority level
+     *
+     * @param threadsCount The number of worker threads of the lowest priority level (at least one)
+     */
+    explicit Dispatcher(std::size_t threadsCount = getDefaultThreadsCount()) : threadingConfig_{} {
+        initLevels(threadsCount);
+    }
+
+    /**
+     * Creates the new dispatcher with the specified threading configuration
+     *
+     * @param threadingConfig The configuration of the workers (the number of the workers, priority levels, names,
+     * affinity, etc.)
+     */
+    explicit Dispatcher(ThreadingConfig threadingConfig) : threadingConfig_{std::move(threadingConfig)} {
+        initLevels(threadingConfig_.threadsCount == 0 ? getDefaultThreadsCount() : threadingConfig_.threadsCount);
+    }
+
+    Dispatcher(const Dispatcher &) = delete;
+    Dispatcher &operator=(const Dispatcher &) = delete;
+
+    /// Executes the remaining tasks and joins the workers
+    ~Dispatcher() {
+        for (auto &level : levels_) {
+            {
+                std::lock_guard<std::mutex> lock{level->mutex};
+
+                level->stopped = true;
+            }
+
+            level->cv.notify_all();
+        }
+
+        for (auto &level : levels_) {
+            for (auto &worker : level->workers) {
+                // The last reference to the dispatcher can be released by one of its own tasks.
+                if (worker.get_id() == std::this_thread::get_id()) {
+                    currentDispatcher() = nullptr;
+                    worker.detach();
+                } else if (worker.joinable()) {
+                    worker.join();
+                }
+            }
+        }
+    }
+
+    /// Returns the dispatcher that is used by handlers by default
+    static Ptr getDefault() {
+        static Ptr instance = std::make_shared<Dispatcher>();
+
+        return instance;
+    }
+
+    /// Returns the number of worker threads of the lowest priority level
+    std::size_t getThreadsCount() const { return getLevel(LOWEST_PRIORITY).threadsCount; }
+
+    /// Returns the number of worker threads of all the priority levels
+    std::size_t getTotalThreadsCount() const { return totalThreadsCount_; }
+
+    /// Returns the number of priority levels
+    std::size_t getPrioritiesCount() const { return levels_.size(); }
+
+    /// Returns the configuration of the workers
+    const ThreadingConfig &getThreadingConfig() const { return threadingConfig_; }
+
+    /// Returns true if the current thread is one of the workers of this dispatcher
+    bool isCurrentThreadWorker() const { return currentDispatcher() == this; }
+
+    /**
+     * Puts the task to the queue of the specified priority level. The task will be executed by one of the workers of
+     * the level.
+     *
+     * @tparam F The task type (any callable without arguments)
+     * @param task The task
+     * @param priority The priority level (0 is the highest one, see HIGHEST_PRIORITY and LOWEST_PRIORITY)
+     */
+    template <typename F> void post(F &&task, std::size_t priority = LOWEST_PRIORITY) {
+        auto &level = getLevel(priority);
+
+        {
+            std::lock_guard<std::mutex> lock{level.mutex};
+
+            if (level.stopped) {
+                return;
+            }
+
+            startWorkers(level);
+            level.tasks.emplace_back(std::forward<F>(task));
+        }
+
+        level.cv.notify_one();
+    }
+};
+
+} // namespace dxfcpp
@@ -6,22 +6,110 @@
 
 #include "common/DXFCppConfig.hpp"
 
-#include <deque>
+#include "utils/Utils.hpp"
+
+#include "Dispatcher.hpp"
+#include "InplaceFunction.hpp"
+#include "ListenerStats.hpp"
+#include "MPSCQueue.hpp"
+#include "RcuPointer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
-#include <future>
+#include <limits>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
 namespace dxfcpp {
+
+/// The policy of a Handler when the queue of calls is full
+enum class OverflowPolicy {
+    /// The caller waits for a free cell
+    BLOCK,
+    /// The oldest queued call is dropped to free a cell
+    DROP_OLDEST,
+    /// The new call is dropped
+    DROP_NEWEST,
+    /// The new call replaces the queued call with the same conflation key (the latest call per key is kept).
+    /// Until the lane is drained, all the new calls of the lane are conflated, so the order per key is preserved.
+    CONFLATE
+};
+
+/// The way a Handler delivers the calls to the listeners
+enum class DeliveryMode {
+    /// The calls are queued and the listeners are called by the workers of the handler's dispatcher
+    ASYNC,
+    /// The listeners are called directly by the thread that calls the handler (no queue, no thread hop, no lock).
+    /// The listeners must be fast, since they delay the caller (for example, the network thread of the connection).
+    INLINE,
+    /// The calls are queued and the listeners are called by the application's thread that polls the handler (see
+    /// Handler::poll). The dispatcher is not used, so no library thread is involved.
+    POLL
+};
+
+/**
+ * The key that identifies a call for the conflation (OverflowPolicy::CONFLATE): the calls with equal keys replace each
+ * other. It is two integers (for example, the type and the symbol id of an event and the index of the event), so
+ * selecting a key does not allocate.
+ */
+struct ConflationKey final {
+    /// The first part of the key
+    std::uint64_t first;
+
+    /// The second part of the key
+    std::uint64_t second;
+
+    friend bool operator==(const ConflationKey &a, const ConflationKey &b) noexcept {
+        return a.first == b.first && a.second == b.second;
+    }
+
+    friend bool operator!=(const ConflationKey &a, const ConflationKey &b) noexcept { return !(a == b); }
+
+    /// The hash of the key
+    struct Hash {
+        std::size_t operator()(const ConflationKey &key) const noexcept {
+            auto hash = (key.first ^ (key.second + 0x9e3779b97f4a7c15ULL + (key.first << 6) + (key.first >> 2))) *
+                        0xff51afd7ed558ccdULL;
+
+            return static_cast<std::size_t>(hash ^ (hash >> 32));
+        }
+    };
+};
+
 /**
  * A thread-safe class that allows to asynchronously notify listeners with a given signature.
- * Listeners can be any callable entities.
- * Listeners are placed in a future. Within one batch, listeners will be called sequentially. Futures are placed in
- * a circular buffer and executed asynchronously.
+ * Listeners can be any callable entities that fit into the InplaceFunction buffer (checked at compile time).
+ * The arguments of each call are put to a bounded lock-free queue, and the caller returns. A single drain task,
+ * executed by a worker of a Dispatcher, takes the arguments from the queue and calls the listeners sequentially, so
+ * the listeners receive the calls in the order of the queue.
  *
- * If you need synchronous execution of listeners, but it was possible to execute them in another thread, then limit
- * the buffer size to one.
+ * What happens if the queue is full is defined by the overflow policy (see OverflowPolicy). By default, the caller
+ * waits for a free cell.
+ *
+ * In the DeliveryMode::INLINE mode the listeners are called by the caller, without the queue. In the
+ * DeliveryMode::POLL mode the queue is drained by the application's thread that calls poll() or pollBusySpin().
+ *
+ * Batch listeners receive all the calls that a drain task has taken from the queue at once (a burst), after the
+ * regular listeners. The arguments of a one-argument call are passed as is, otherwise as tuples.
+ *
+ * The handler can be split into several lanes (shards). Each lane has its own queue and its own drain task, and a lane
+ * selector maps the arguments of a call to a lane. Calls of one lane are delivered in order by one worker at a time,
+ * while different lanes are delivered in parallel (for example, per-symbol order of events across all the workers).
+ *
+ * The execution time of each listener can be measured (see setStatsEnabled, setWatchdog and getListenerStats).
+ *
+ * The listeners are kept in an immutable snapshot (copy-on-write). Dispatch reads the snapshot through an atomic
+ * pointer without locks, and only add/remove copy the snapshot, so registration and dispatch never block each other.
  *
  * @tparam Signature The arguments "signature" (example: `void(int, int)`)
  */
@@ -30,83 +118,683 @@ struct Handler;
 
 /**
  * A thread-safe class that allows to asynchronously notify listeners with a given signature.
- * Listeners can be any callable entities.
- * Listeners are placed in a future. Within one batch, listeners will be called sequentially. Futures are placed in
- * a circular buffer and executed asynchronously.
+ * Listeners can be any callable entities that fit into the InplaceFunction buffer (checked at compile time).
+ * The arguments of each call are put to a bounded lock-free queue, and the caller returns. A single drain task,
+ * executed by a worker of a Dispatcher, takes the arguments from the queue and calls the listeners sequentially, so
+ * the listeners receive the calls in the order of the queue.
+ *
+ * What happens if the queue is full is defined by the overflow policy (see OverflowPolicy). By default, the caller
+ * waits for a free cell.
+ *
+ * In the DeliveryMode::INLINE mode the listeners are called by the caller, without the queue. In the
+ * DeliveryMode::POLL mode the queue is drained by the application's thread that calls poll() or pollBusySpin().
+ *
+ * Batch listeners receive all the calls that a drain task has taken from the queue at once (a burst), after the
+ * regular listeners. The arguments of a one-argument call are passed as is, otherwise as tuples.
+ *
+ * The handler can be split into several lanes (shards). Each lane has its own queue and its own drain task, and a lane
+ * selector maps the arguments of a call to a lane. Calls of one lane are delivered in order by one worker at a time,
+ * while different lanes are delivered in parallel (for example, per-symbol order of events across all the workers).
  *
- * If you need synchronous execution of listeners, but it was possible to execute them in another thread, then limit
- * the buffer size to one.
+ * The execution time of each listener can be measured (see setStatsEnabled, setWatchdog and getListenerStats).
+ *
+ * The listeners are kept in an immutable snapshot (copy-on-write). Dispatch reads the snapshot through an atomic
+ * pointer without locks, and only add/remove copy the snapshot, so registration and dispatch never block each other.
  *
  * @tparam ArgTypes The arguments "signature" (example: `void(int, int)`)
  */
 template<typename... ArgTypes>
 struct Handler<void(ArgTypes...)> final {
-    /// The listener type
-    using ListenerType = std::function<void(ArgTypes...)>;
+    /// The listener type (any callable entity whose size fits into the InplaceFunction's buffer; the listeners are
+    /// stored without heap allocations of their captures)
+    using ListenerType = InplaceFunction<void(ArgTypes...)>;
+
+    /// The type of a call in a batch (the argument for one-argument calls, the tuple of the arguments otherwise)
+    using BatchElementType = typename meta::UnpackedTuple<typename std::decay<ArgTypes>::type...>::Type;
+
+    /// The batch listener type
+    using BatchListenerType = InplaceFunction<void(const std::vector<BatchElementType> &)>;
+
+    /// The watchdog type (accepts the id of the slow listener and its execution time)
+    using WatchdogType = std::function<void(std::size_t, std::chrono::nanoseconds)>;
+
+    /// The lane selector type (returns the hash of the arguments; the lane is the hash modulo the number of lanes)
+    using LaneSelectorType = std::function<std::size_t(const typename std::decay<ArgTypes>::type &...)>;
+
+    /// The conflation key selector type (calls with the same key replace each other when the calls are conflated)
+    using ConflationKeySelectorType = std::function<ConflationKey(const typename std::decay<ArgTypes>::type &...)>;
+
+    /// The default capacity of the queue of calls
+    static DXFCPP_USE_CONSTEXPR std::size_t DEFAULT_QUEUE_SIZE = 1024;
 
 private:
-    static constexpr unsigned MAIN_FUTURES_DEFAULT_SIZE = 1024;
-
-    std::recursive_mutex listenersMutex_{};
-    std::unordered_map<std::size_t, ListenerType> listeners_{};
-    std::unordered_map<std::size_t, ListenerType> lowPriorityListeners_{};
-    std::size_t lastId_{};
-
-    std::recursive_mutex mainFuturesMutex_{};
-    std::vector<std::shared_future<void>> mainFutures_{};
-    std::size_t mainFuturesCurrentIndex_{};
-    const std::size_t mainFuturesSize_{};
-
-    std::shared_future<void> handleImpl(ArgTypes...args) {
-        return std::async(
-                std::launch::async,
-                [this](ArgTypes...args) {
-                    std::lock_guard<std::recursive_mutex> guard{listenersMutex_};
-
-                    for (auto &listener: listeners_) {
-                        listener.second(args...);
-                    }
+    using ElementType = std::tuple<typename std::decay<ArgTypes>::type...>;
+    using ElementUnpacker = meta::UnpackedTuple<typename std::decay<ArgTypes>::type...>;
+
+    /// The queue of calls with its own drain task. Only one drain task of a lane exists at a time, so the queue has a
+    /// single consumer.
+    struct Lane {
+        MPSCQueue<ElementType> queue;
+        std::atomic<bool> drainScheduled{false};
+
+        // The conflated calls that are newer than all the calls in the queue. They are delivered in the order of their
+        // keys' first appearance.
+        std::atomic<bool> conflating{false};
+        std::mutex conflatedMutex{};
+        std::unordered_map<ConflationKey, ElementType, ConflationKey::Hash> conflated{};
+        std::vector<ConflationKey> conflatedOrder{};
+
+        // The current burst for the batch listeners
+        std::vector<BatchElementType> batch{};
+
+        explicit Lane(std::size_t queueSize) : queue{queueSize} {}
+    };
+
+    // The statistics are mutable, since the entries are shared by the immutable snapshots
+    template<typename L>
+    struct Entry {
+        std::size_t id;
+        L listener;
+        mutable ListenerStatsCollector stats{};
+
+        Entry(std::size_t i, L &&l) : id{i}, listener{std::move(l)} {}
+    };
+
+    using ListenerEntry = Entry<ListenerType>;
+    using ListenerEntryPtr = std::shared_ptr<const ListenerEntry>;
+    using BatchListenerEntry = Entry<BatchListenerType>;
+    using BatchListenerEntryPtr = std::shared_ptr<const BatchListenerEntry>;
+
+    /// The immutable snapshot of the listeners. Entries are shared between snapshots, so a mutation copies pointers
+    /// only.
+    struct Listeners {
+        std::vector<ListenerEntryPtr> main{};
+        std::vector<ListenerEntryPtr> lowPriority{};
+        std::vector<BatchListenerEntryPtr> batch{};
+    };
+
+    RcuPointer<Listeners> listeners_{std::unique_ptr<const Listeners>(new Listeners{})};
+    std::atomic<std::size_t> lastId_{};
+
+    std::vector<std::unique_ptr<Lane>> lanes_{};
+    const LaneSelectorType laneSelector_;
+    const ConflationKeySelectorType conflationKeySelector_;
+
+    std::atomic<DeliveryMode> deliveryMode_{DeliveryMode::ASYNC};
+    std::atomic<OverflowPolicy> overflowPolicy_{OverflowPolicy::BLOCK};
+    std::atomic<std::uint64_t> droppedCount_{};
+    std::atomic<std::uint64_t> conflatedCount_{};
+    std::atomic<std::size_t> nextPolledLane_{};
+    std::atomic<std::size_t> priority_{Dispatcher::LOWEST_PRIORITY};
+
+    std::atomic<bool> statsEnabled_{false};
+    std::atomic<std::uint64_t> watchdogBudgetNanos_{0};
+    std::shared_ptr<const WatchdogType> watchdog_{};
+
+    std::mutex drainsMutex_{};
+    std::condition_variable drainsCv_{};
+    std::size_t pendingDrains_{};
+
+    const Dispatcher::Ptr dispatcher_;
+
+    template<typename E, typename... Args>
+    void invoke(const E &entry, bool timed, Args &&...args) {
+        if (!timed) {
+            entry.listener(std::forward<Args>(args)...);
+
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        entry.listener(std::forward<Args>(args)...);
+
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        entry.stats.record(static_cast<std::uint64_t>(duration.count()));
+
+        auto budget = watchdogBudgetNanos_.load(std::memory_order_relaxed);
+
+        if (budget != 0 && static_cast<std::uint64_t>(duration.count()) > budget) {
+            if (auto watchdog = std::atomic_load(&watchdog_)) {
+                (*watchdog)(entry.id, duration);
+            }
+        }
+    }
+
+    void callListeners(ArgTypes...args) {
+        bool timed = statsEnabled_.load(std::memory_order_relaxed);
+
+        listeners_.read([this, timed, &args...](const Listeners &listeners) {
+            for (const auto &entry: listeners.main) {
+                invoke(*entry, timed, args...);
+            }
+
+            for (const auto &entry: listeners.lowPriority) {
+                invoke(*entry, timed, args...);
+            }
+        });
+    }
+
+    void callBatchListeners(const std::vector<BatchElementType> &batch) {
+        bool timed = statsEnabled_.load(std::memory_order_relaxed);
+
+        listeners_.read([this, timed, &batch](const Listeners &listeners) {
+            for (const auto &entry: listeners.batch) {
+                invoke(*entry, timed, batch);
+            }
+        });
+    }
+
+    bool hasBatchListeners() {
+        bool result = false;
 
-                    for (auto &listener: lowPriorityListeners_) {
-                        listener.second(args...);
+        listeners_.read([&result](const Listeners &listeners) { result = !listeners.batch.empty(); });
+
+        return result;
+    }
+
+    void callListenersInline(ArgTypes...args) {
+        callListeners(args...);
+
+        if (hasBatchListeners()) {
+            std::vector<BatchElementType> batch{};
+
+            batch.emplace_back(ElementUnpacker::unpack(ElementType{args...}));
+            callBatchListeners(batch);
+        }
+    }
+
+    template<std::size_t... Is>
+    void callListenersInline(ElementType &element, meta::IndexSequence<Is...>) {
+        callListenersInline(std::get<Is>(element)...);
+    }
+
+    static ElementType toElement(const BatchElementType &element, std::true_type /* one argument */) {
+        return ElementType{element};
+    }
+
+    static ElementType toElement(const BatchElementType &element, std::false_type /* several arguments */) {
+        return element;
+    }
+
+    std::size_t addImpl(ListenerType &&listener, bool lowPriority) {
+        auto id = ++lastId_;
+        auto entry = std::make_shared<const ListenerEntry>(id, std::move(listener));
+
+        listeners_.update([&entry, lowPriority](const Listeners &old) {
+            std::unique_ptr<Listeners> result{new Listeners(old)};
+
+            (lowPriority ? result->lowPriority : result->main).push_back(entry);
+
+            return std::unique_ptr<const Listeners>(std::move(result));
+        });
+
+        return id;
+    }
+
+    template<std::size_t... Is>
+    void callListeners(ElementType &element, meta::IndexSequence<Is...>) {
+        callListeners(std::get<Is>(element)...);
+    }
+
+    void deliver(Lane &lane, ElementType &&element, bool batching) {
+        callListeners(element, meta::MakeIndexSequence<sizeof...(ArgTypes)>{});
+
+        if (batching) {
+            lane.batch.emplace_back(ElementUnpacker::unpack(std::move(element)));
+        }
+    }
+
+    void flushBatch(Lane &lane) {
+        if (lane.batch.empty()) {
+            return;
+        }
+
+        callBatchListeners(lane.batch);
+        lane.batch.clear();
+    }
+
+    std::size_t pollLane(Lane &lane, std::size_t maxCalls) {
+        if (lane.drainScheduled.exchange(true)) {
+            return 0;
+        }
+
+        std::size_t result = 0;
+        bool batching = hasBatchListeners();
+        auto consumer = [this, &lane, batching](ElementType &&element) {
+            deliver(lane, std::move(element), batching);
+        };
+
+        while (result < maxCalls && lane.queue.tryPop(consumer)) {
+            result++;
+        }
+
+        // The conflated calls are newer than all the queued ones.
+        if (result < maxCalls) {
+            result += drainConflated(lane, batching);
+        }
+
+        flushBatch(lane);
+        lane.drainScheduled.store(false);
+
+        return result;
+    }
+
+    template<std::size_t... Is>
+    Lane &selectLane(const ElementType &element, meta::IndexSequence<Is...>) {
+        if (lanes_.size() == 1 || !laneSelector_) {
+            return *lanes_.front();
+        }
+
+        return *lanes_[laneSelector_(std::get<Is>(element)...) % lanes_.size()];
+    }
+
+    template<std::size_t... Is>
+    ConflationKey selectConflationKey(const ElementType &element, meta::IndexSequence<Is...>) {
+        if (!conflationKeySelector_) {
+            return {};
+        }
+
+        return conflationKeySelector_(std::get<Is>(element)...);
+    }
+
+    void conflate(Lane &lane, ElementType &&element) {
+        auto key = selectConflationKey(element, meta::MakeIndexSequence<sizeof...(ArgTypes)>{});
+
+        std::lock_guard<std::mutex> lock{lane.conflatedMutex};
+
+        lane.conflating.store(true);
+
+        auto found = lane.conflated.find(key);
+
+        if (found == lane.conflated.end()) {
+            lane.conflatedOrder.push_back(key);
+            lane.conflated.emplace(std::move(key), std::move(element));
+        } else {
+            found->second = std::move(element);
+            conflatedCount_++;
+        }
+    }
+
+    // Delivers the conflated calls. Returns the number of the delivered calls.
+    std::size_t drainConflated(Lane &lane, bool batching) {
+        if (!lane.conflating.load()) {
+            return 0;
+        }
+
+        std::unordered_map<ConflationKey, ElementType, ConflationKey::Hash> conflated{};
+        std::vector<ConflationKey> conflatedOrder{};
+
+        {
+            std::lock_guard<std::mutex> lock{lane.conflatedMutex};
+
+            conflated.swap(lane.conflated);
+            conflatedOrder.swap(lane.conflatedOrder);
+            lane.conflating.store(false);
+        }
+
+        for (const auto &key: conflatedOrder) {
+            deliver(lane, std::move(conflated.at(key)), batching);
+        }
+
+        return conflatedOrder.size();
+    }
+
+    void drain(Lane &lane) {
+        while (true) {
+            bool batching = hasBatchListeners();
+            auto consumer = [this, &lane, batching](ElementType &&element) {
+                deliver(lane, std::move(element), batching);
+            };
+
+            do {
+                while (lane.queue.tryPop(consumer)) {
+                    // The burst is limited by the capacity of the queue, so that a producer that keeps up with the
+                    // drain does not postpone the batch listeners forever.
+                    if (lane.batch.size() >= lane.queue.capacity()) {
+                        flushBatch(lane);
                     }
-                },
-                args...);
+                }
+            } while (drainConflated(lane, batching) != 0);
+
+            flushBatch(lane);
+            lane.drainScheduled.store(false);
+
+            // A producer that has seen drainScheduled == true relies on this drain to take its element.
+            if ((lane.queue.empty() && !lane.conflating.load()) || lane.drainScheduled.exchange(true)) {
+                break;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock{drainsMutex_};
+
+        pendingDrains_--;
+        drainsCv_.notify_all();
+    }
+
+    void scheduleDrain(Lane &lane) {
+        // The polling thread drains the queue (and uses drainScheduled as the flag of the lane's consumer).
+        if (deliveryMode_.load(std::memory_order_relaxed) == DeliveryMode::POLL) {
+            return;
+        }
+
+        if (lane.drainScheduled.exchange(true)) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{drainsMutex_};
+
+            pendingDrains_++;
+        }
+
+        dispatcher_->post([this, &lane]() { drain(lane); }, priority_.load(std::memory_order_relaxed));
+    }
+
+    // Queues the call, or acts according to the overflow policy if the queue of the lane is full
+    void enqueue(ElementType &&element) {
+        Lane &lane = selectLane(element, meta::MakeIndexSequence<sizeof...(ArgTypes)>{});
+
+        // The newer calls must not overtake the conflated ones.
+        if (lane.conflating.load()) {
+            conflate(lane, std::move(element));
+            scheduleDrain(lane);
+
+            return;
+        }
+
+        while (!lane.queue.tryPush(element)) {
+            auto policy = overflowPolicy_.load();
+
+            if (policy == OverflowPolicy::DROP_NEWEST) {
+                droppedCount_++;
+                scheduleDrain(lane);
+
+                return;
+            }
+
+            if (policy == OverflowPolicy::CONFLATE) {
+                conflate(lane, std::move(element));
+                scheduleDrain(lane);
+
+                return;
+            }
+
+            if (policy == OverflowPolicy::DROP_OLDEST) {
+                if (lane.queue.tryPop([](ElementType &&) {})) {
+                    droppedCount_++;
+                }
+
+                continue;
+            }
+
+            if (deliveryMode_.load() != DeliveryMode::POLL && dispatcher_->isCurrentThreadWorker()) {
+                callListenersInline(element, meta::MakeIndexSequence<sizeof...(ArgTypes)>{});
+
+                return;
+            }
+
+            scheduleDrain(lane);
+            std::this_thread::yield();
+        }
+
+        scheduleDrain(lane);
     }
 
 public:
     /**
-     * Creates the new handler by specified size of circular buffer of futures
+     * Creates the new handler by specified capacity of the queue of calls
+     *
+     * @param queueSize The capacity of the queue of calls (will be rounded up to a power of two)
+     * @param dispatcher The dispatcher whose workers will call the listeners
+     */
+    explicit Handler(std::size_t queueSize = DEFAULT_QUEUE_SIZE, Dispatcher::Ptr dispatcher = Dispatcher::getDefault())
+            : Handler(queueSize, std::move(dispatcher), 1, nullptr) {}
+
+    /**
+     * Creates the new handler split into lanes
      *
-     * @param mainFuturesSize The size of the circular buffer of futures
+     * @param queueSize The capacity of the queue of calls of each lane (will be rounded up to a power of two)
+     * @param dispatcher The dispatcher whose workers will call the listeners
+     * @param lanesCount The number of lanes (at least one)
+     * @param laneSelector The lane selector (if it is empty, all the calls go to the first lane)
+     * @param conflationKeySelector The conflation key selector for the OverflowPolicy::CONFLATE policy (if it is
+     * empty, all the calls have the same key)
      */
-    explicit Handler(std::size_t mainFuturesSize = MAIN_FUTURES_DEFAULT_SIZE)
-            : mainFuturesCurrentIndex_{0ULL}, mainFuturesSize_{mainFuturesSize} {
-        mainFutures_.reserve(mainFuturesSize);
+    Handler(std::size_t queueSize, Dispatcher::Ptr dispatcher, std::size_t lanesCount, LaneSelectorType laneSelector,
+            ConflationKeySelectorType conflationKeySelector = nullptr)
+            : laneSelector_{std::move(laneSelector)}, conflationKeySelector_{std::move(conflationKeySelector)},
+              dispatcher_{std::move(dispatcher)} {
+        lanesCount = std::max(lanesCount, static_cast<std::size_t>(1));
+        lanes_.reserve(lanesCount);
+
+        for (std::size_t i = 0; i < lanesCount; i++) {
+            lanes_.emplace_back(new Lane(queueSize));
+        }
+    }
+
+    Handler(const Handler &) = delete;
+    Handler &operator=(const Handler &) = delete;
+
+    /// Waits for the drain task that is still calling the listeners, since it refers to this handler
+    ~Handler() {
+        std::unique_lock<std::mutex> lock{drainsMutex_};
+
+        drainsCv_.wait(lock, [this] { return pendingDrains_ == 0; });
+    }
+
+    /// Returns the dispatcher whose workers call the listeners
+    const Dispatcher::Ptr &getDispatcher() const { return dispatcher_; }
+
+    /// Returns the number of lanes
+    std::size_t getLanesCount() const { return lanes_.size(); }
+
+    /// Returns true if the handler has no listeners (including the low priority and the batch ones)
+    bool isEmpty() const {
+        bool result = true;
+
+        listeners_.read([&result](const Listeners &listeners) {
+            result = listeners.main.empty() && listeners.lowPriority.empty() && listeners.batch.empty();
+        });
+
+        return result;
     }
 
+    /// Returns the priority level of the dispatcher that delivers the calls
+    std::size_t getPriority() const { return priority_.load(); }
+
+    /**
+     * Sets the priority level of the dispatcher that delivers the calls. The calls of a higher level are delivered by
+     * other workers, so they are not delayed by the backlog of the lower levels.
+     *
+     * @param priority The priority level (Dispatcher::HIGHEST_PRIORITY is the highest one, the default one is
+     * Dispatcher::LOWEST_PRIORITY)
+     */
+    void setPriority(std::size_t priority) { priority_.store(priority); }
+
+    /// Returns the current delivery mode
+    DeliveryMode getDeliveryMode() const { return deliveryMode_.load(); }
+
+    /**
+     * Sets the delivery mode. The calls that were queued before the mode is changed to DeliveryMode::INLINE can be
+     * delivered after the new inline calls, so the mode should be set before the calls begin.
+     *
+     * @param deliveryMode The new delivery mode
+     */
+    void setDeliveryMode(DeliveryMode deliveryMode) { deliveryMode_.store(deliveryMode); }
+
+    /// Returns the current overflow policy
+    OverflowPolicy getOverflowPolicy() const { return overflowPolicy_.load(); }
+
+    /**
+     * Sets the overflow policy. It can be changed at any time, the calls that are already conflated are delivered
+     * anyway.
+     *
+     * @param overflowPolicy The new overflow policy
+     */
+    void setOverflowPolicy(OverflowPolicy overflowPolicy) { overflowPolicy_.store(overflowPolicy); }
+
+    /// Returns the number of calls that were dropped by the OverflowPolicy::DROP_OLDEST or OverflowPolicy::DROP_NEWEST
+    /// policies
+    std::uint64_t getDroppedCount() const { return droppedCount_.load(); }
+
+    /// Returns the number of calls that were replaced by newer calls with the same key (OverflowPolicy::CONFLATE)
+    std::uint64_t getConflatedCount() const { return conflatedCount_.load(); }
+
     /**
-     * Calls the listeners and pass the args to them
+     * Calls the listeners and pass the args to them.
+     * Puts the args to the queue and returns. If the queue is full, acts according to the overflow policy.
+     * In the DeliveryMode::INLINE mode calls the listeners directly.
+     *
+     * If the policy is OverflowPolicy::BLOCK, the mode is not DeliveryMode::POLL, it is called by a worker of the
+     * handler's dispatcher (for example, from another listener) and the queue is full, the listeners are called
+     * synchronously, so that a worker never waits for a task that is queued behind it.
      *
      * @param args The listeners arguments
      */
     void handle(ArgTypes...args) {
-        auto f = handleImpl(args...);
+        if (deliveryMode_.load(std::memory_order_relaxed) == DeliveryMode::INLINE) {
+            callListenersInline(args...);
 
-        {
-            std::lock_guard<std::recursive_mutex> guard{mainFuturesMutex_};
-
-            if (mainFutures_.size() < mainFuturesSize_) {
-                mainFutures_.emplace_back(f);
-            } else {
-                mainFuturesCurrentIndex_ = mainFuturesCurrentIndex_ % mainFuturesSize_;
-                mainFutures_[mainFuturesCurrentIndex_].wait();
-                mainFutures_[mainFuturesCurrentIndex_] = f;
-                mainFuturesCurrentIndex_++;
+            return;
+        }
+
+        enqueue(ElementType{args...});
+    }
+
+    /**
+     * Calls the listeners for each call of the batch, in order.
+     *
+     * Only the DeliveryMode::INLINE mode delivers the batch as one call: the regular listeners are called for each
+     * call of the batch and then the batch listeners are called once with the whole batch. In the queued modes
+     * (DeliveryMode::ASYNC and DeliveryMode::POLL) each call of the batch is enqueued separately, as if handle() were
+     * called for each of them (the overflow policy is applied per call), and the batch listeners receive the bursts
+     * of the drain task, which are not aligned with the batches.
+     *
+     * @param batch The batch of calls
+     */
+    void handleBatch(const std::vector<BatchElementType> &batch) {
+        if (batch.empty()) {
+            return;
+        }
+
+        std::integral_constant<bool, sizeof...(ArgTypes) == 1> isOneArgument{};
+
+        if (deliveryMode_.load(std::memory_order_relaxed) == DeliveryMode::INLINE) {
+            for (const auto &element: batch) {
+                auto e = toElement(element, isOneArgument);
+
+                callListeners(e, meta::MakeIndexSequence<sizeof...(ArgTypes)>{});
+            }
+
+            if (hasBatchListeners()) {
+                callBatchListeners(batch);
             }
+
+            return;
+        }
+
+        for (const auto &element: batch) {
+            enqueue(toElement(element, isOneArgument));
+        }
+    }
+
+    /// Returns true if the execution time of the listeners is measured
+    bool isStatsEnabled() const { return statsEnabled_.load(); }
+
+    /**
+     * Enables or disables the measurement of the execution time of the listeners (two clock reads per listener call).
+     * The measurement is disabled by default.
+     *
+     * @param statsEnabled true to enable the measurement
+     */
+    void setStatsEnabled(bool statsEnabled) { statsEnabled_.store(statsEnabled); }
+
+    /**
+     * Sets the slow listener watchdog and enables the measurement of the execution time. The watchdog is called by the
+     * thread that has called the listener, right after a listener call that has taken longer than the budget.
+     *
+     * @param budget The execution time budget of a listener call (zero disables the watchdog)
+     * @param watchdog The watchdog that accepts the listener id and the execution time
+     */
+    void setWatchdog(std::chrono::nanoseconds budget, WatchdogType watchdog) {
+        std::atomic_store(&watchdog_, std::shared_ptr<const WatchdogType>(
+                                              watchdog ? new WatchdogType(std::move(watchdog)) : nullptr));
+        watchdogBudgetNanos_.store(budget.count() > 0 ? static_cast<std::uint64_t>(budget.count()) : 0);
+
+        if (budget.count() > 0) {
+            statsEnabled_.store(true);
         }
     }
 
+    /**
+     * Returns the snapshot of the execution time statistics of all the current listeners (including the batch ones).
+     * The statistics are collected while the measurement is enabled (see setStatsEnabled).
+     *
+     * @return The statistics of the listeners
+     */
+    std::vector<ListenerStats> getListenerStats() const {
+        std::vector<ListenerStats> result{};
+
+        listeners_.read([&result](const Listeners &listeners) {
+            for (const auto &entry: listeners.main) {
+                result.push_back(entry->stats.getSnapshot(entry->id));
+            }
+
+            for (const auto &entry: listeners.lowPriority) {
+                result.push_back(entry->stats.getSnapshot(entry->id));
+            }
+
+            for (const auto &entry: listeners.batch) {
+                result.push_back(entry->stats.getSnapshot(entry->id));
+            }
+        });
+
+        return result;
+    }
+
+    /**
+     * Delivers the queued calls to the listeners by the current thread (DeliveryMode::POLL). The lanes are polled in
+     * turn. Only one thread can poll a lane at a time, the lanes that are being polled by other threads are skipped.
+     *
+     * The conflated calls of a lane are delivered when the queue of the lane has been emptied, so the result can exceed
+     * maxCalls by the number of such calls.
+     *
+     * @param maxCalls The maximal number of the queued calls to deliver
+     * @return The number of the delivered calls
+     */
+    std::size_t poll(std::size_t maxCalls = std::numeric_limits<std::size_t>::max()) {
+        std::size_t result = 0;
+        std::size_t lane = nextPolledLane_++;
+
+        for (std::size_t i = 0; i < lanes_.size() && result < maxCalls; i++) {
+            result += pollLane(*lanes_[(lane + i) % lanes_.size()], maxCalls - result);
+        }
+
+        return result;
+    }
+
+    /**
+     * Busy-spins the current thread delivering the queued calls until the deadline (DeliveryMode::POLL). The thread is
+     * not yielded, which gives the lowest latency at the cost of a fully loaded core.
+     *
+     * @tparam Clock The clock type
+     * @tparam Duration The duration type
+     * @param deadline The time point until which the calls are polled
+     * @return The number of the delivered calls
+     */
+    template<typename Clock, typename Duration>
+    std::size_t pollBusySpin(const std::chrono::time_point<Clock, Duration> &deadline) {
+        std::size_t result = 0;
+
+        while (Clock::now() < deadline) {
+            result += poll();
+        }
+
+        return result;
+    }
+
     /**
      * Calls the listeners and pass the ars to them
      *
@@ -120,14 +808,7 @@ public:
      * @param listener The listener
      * @return The listener id
      */
-    std::size_t add(ListenerType &&listener) {
-        std::lock_guard<std::recursive_mutex> guard{listenersMutex_};
-
-        lastId_++;
-        listeners_.emplace(lastId_, std::forward<ListenerType>(listener));
-
-        return lastId_;
-    }
+    std::size_t add(ListenerType &&listener) { return addImpl(std::forward<ListenerType>(listener), false); }
 
     /**
      * Adds the low priority listener (to the "low priority" group)
@@ -137,12 +818,7 @@ public:
      * @return The listener id
      */
     std::size_t addLowPriority(ListenerType &&listener) {
-        std::lock_guard<std::recursive_mutex> guard{listenersMutex_};
-
-        lastId_++;
-        lowPriorityListeners_.emplace(lastId_, std::forward<ListenerType>(listener));
-
-        return lastId_;
+        return addImpl(std::forward<ListenerType>(listener), true);
     }
 
     /**
@@ -162,19 +838,50 @@ public:
      */
     std::size_t operator%=(ListenerType &&listener) { return addLowPriority(std::forward<ListenerType>(listener)); }
 
+    /**
+     * Adds the batch listener. It will be called once per burst of calls (all the calls that were queued since the
+     * previous wakeup of the drain task, but not more than the capacity of the queue), after the regular listeners
+     * have been called for each call of the burst. In the DeliveryMode::INLINE mode each burst consists of one call.
+     *
+     * @param listener The batch listener
+     * @return The listener id
+     */
+    std::size_t addBatch(BatchListenerType &&listener) {
+        auto id = ++lastId_;
+        auto entry = std::make_shared<const BatchListenerEntry>(id, std::move(listener));
+
+        listeners_.update([&entry](const Listeners &old) {
+            std::unique_ptr<Listeners> result{new Listeners(old)};
+
+            result->batch.push_back(entry);
+
+            return std::unique_ptr<const Listeners>(std::move(result));
+        });
+
+        return id;
+    }
+
     /**
      * Removes a listener by the id
      *
      * @param id The listener id
      */
     void remove(std::size_t id) {
-        std::lock_guard<std::recursive_mutex> guard{listenersMutex_};
+        listeners_.update([id](const Listeners &old) {
+            std::unique_ptr<Listeners> result{new Listeners(old)};
+            auto hasId = [id](const ListenerEntryPtr &entry) { return entry->id == id; };
 
-        if (listeners_.count(id) > 0) {
-            listeners_.erase(id);
-        } else if (lowPriorityListeners_.count(id) > 0) {
-            lowPriorityListeners_.erase(id);
-        }
+            result->main.erase(std::remove_if(result->main.begin(), result->main.end(), hasId), result->main.end());
+            result->lowPriority.erase(
+                    std::remove_if(result->lowPriority.begin(), result->lowPriority.end(), hasId),
+                    result->lowPriority.end());
+            result->batch.erase(
+                    std::remove_if(result->batch.begin(), result->batch.end(),
+                                   [id](const BatchListenerEntryPtr &entry) { return entry->id == id; }),
+                    result->batch.end());
+
+            return std::unique_ptr<const Listeners>(std::move(result));
+        });
     }
 
     /**
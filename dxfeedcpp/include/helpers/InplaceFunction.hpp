@@ -0,0 +1,140 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+#include "common/DXFCppConfig.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace dxfcpp {
+
+/**
+ * A move-only type-erased callable that keeps the callable object in an internal fixed-size buffer.
+ *
+ * Unlike std::function it never allocates: a callable that does not fit into the buffer (for example, a lambda with
+ * too many captures) is rejected at compile time. A call is one indirect call without additional pointer chasing.
+ *
+ * @tparam Signature The call signature (example: `void(int, int)`)
+ * @tparam Capacity The size of the buffer in bytes
+ */
+template <typename Signature, std::size_t Capacity = 64> class InplaceFunction;
+
+/**
+ * A move-only type-erased callable that keeps the callable object in an internal fixed-size buffer.
+ *
+ * @tparam R The result type
+ * @tparam ArgTypes The argument types
+ * @tparam Capacity The size of the buffer in bytes
+ */
+template <typename R, typename... ArgTypes, std::size_t Capacity>
+class InplaceFunction<R(ArgTypes...), Capacity> final {
+    using StorageType = typename std::aligned_storage<Capacity, alignof(std::max_align_t)>::type;
+
+    // Calls the callable that is stored in the buffer
+    using InvokerType = R (*)(void *, ArgTypes &&...);
+
+    // Moves the callable from the source buffer to the destination buffer (if it is not null) and destroys the source
+    using ManagerType = void (*)(void *, void *);
+
+    mutable StorageType storage_;
+    InvokerType invoker_ = nullptr;
+    ManagerType manager_ = nullptr;
+
+    void reset() {
+        if (manager_ != nullptr) {
+            manager_(nullptr, &storage_);
+            invoker_ = nullptr;
+            manager_ = nullptr;
+        }
+    }
+
+    void moveFrom(InplaceFunction &other) {
+        if (other.manager_ != nullptr) {
+            other.manager_(&storage_, &other.storage_);
+            invoker_ = other.invoker_;
+            manager_ = other.manager_;
+            other.invoker_ = nullptr;
+            other.manager_ = nullptr;
+        }
+    }
+
+  public:
+    /// The size of the buffer in bytes
+    static DXFCPP_USE_CONSTEXPR std::size_t CAPACITY = Capacity;
+
+    /// Creates the empty callable
+    InplaceFunction() noexcept {}
+
+    /// Creates the empty callable
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    /**
+     * Creates the callable by moving or copying the callable object into the buffer
+     *
+     * @tparam F The type of the callable object. Must fit into the buffer, otherwise the compilation fails.
+     * @param f The callable object
+     */
+    template <typename F, typename = typename std::enable_if<
+                              !std::is_same<typename std::decay<F>::type, InplaceFunction>::value>::type>
+    InplaceFunction(F &&f) {
+        using FunctorType = typename std::decay<F>::type;
+
+        static_assert(sizeof(FunctorType) <= Capacity,
+                      "The callable is too large for the InplaceFunction: reduce the captures or increase Capacity");
+        static_assert(alignof(FunctorType) <= alignof(StorageType),
+                      "The callable is over-aligned for the InplaceFunction");
+
+        new (&storage_) FunctorType(std::forward<F>(f));
+
+        invoker_ = [](void *storage, ArgTypes &&...args) -> R {
+            return (*static_cast<FunctorType *>(storage))(std::forward<ArgTypes>(args)...);
+        };
+
+        manager_ = [](void *destination, void *source) {
+            auto functor = static_cast<FunctorType *>(source);
+
+            if (destination != nullptr) {
+                new (destination) FunctorType(std::move(*functor));
+            }
+
+            functor->~FunctorType();
+        };
+    }
+
+    InplaceFunction(const InplaceFunction &) = delete;
+    InplaceFunction &operator=(const InplaceFunction &) = delete;
+
+    /// Moves the callable object from the other InplaceFunction (which becomes empty)
+    InplaceFunction(InplaceFunction &&other) noexcept { moveFrom(other); }
+
+    /// Moves the callable object from the other InplaceFunction (which becomes empty)
+    InplaceFunction &operator=(InplaceFunction &&other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+
+        return *this;
+    }
+
+    /// Destroys the callable object
+    ~InplaceFunction() { reset(); }
+
+    /// Returns true if the callable is not empty
+    explicit operator bool() const noexcept { return invoker_ != nullptr; }
+
+    /**
+     * Calls the callable object. The callable must not be empty.
+     *
+     * @param args The arguments
+     * @return The result of the call
+     */
+    R operator()(ArgTypes... args) const { return invoker_(&storage_, std::forward<ArgTypes>(args)...); }
+};
+
+} // namespace dxfcpp
@@ -0,0 +1,263 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+#include "common/DXFCppConfig.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace dxfcpp {
+
+/// The reference counting policy of IntrusivePtr for the objects that are shared between threads
+struct AtomicRefCount {
+    ///
+    static void increment(std::atomic<std::uint32_t> &count) noexcept { count.fetch_add(1, std::memory_order_relaxed); }
+
+    /// Returns true if the last reference has been released
+    static bool decrement(std::atomic<std::uint32_t> &count) noexcept {
+        return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+};
+
+/**
+ * The reference counting policy of IntrusivePtr for single-thread pipelines: the counter is updated by the plain
+ * loads and stores (no locked instructions), so all the references to the object must be held by one thread at a time.
+ */
+struct LocalRefCount {
+    ///
+    static void increment(std::atomic<std::uint32_t> &count) noexcept {
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /// Returns true if the last reference has been released
+    static bool decrement(std::atomic<std::uint32_t> &count) noexcept {
+        auto result = count.load(std::memory_order_relaxed) - 1;
+
+        count.store(result, std::memory_order_relaxed);
+
+        return result == 0;
+    }
+};
+
+template <typename T, typename RefCount> class IntrusivePtr;
+template <typename T> class ObjectPool;
+
+template <typename T, typename RefCount = AtomicRefCount, typename... Args>
+IntrusivePtr<T, RefCount> makeIntrusive(Args &&...args);
+
+/**
+ * The base class of the objects that can be held by IntrusivePtr: the reference counter and the function that
+ * destroys the object are stored in the object itself (16 bytes on 64-bit platforms). Copies of the object do not
+ * share the counter.
+ *
+ * Only the objects that are created by makeIntrusive() or ObjectPool<T>::makeIntrusive() can be held by IntrusivePtr:
+ * the objects that are created otherwise (on the stack, by std::make_shared etc.) have no destroy function.
+ */
+class IntrusiveRefCounted {
+    template <typename, typename> friend class IntrusivePtr;
+    template <typename> friend class ObjectPool;
+
+    template <typename T, typename RefCount, typename... Args>
+    friend IntrusivePtr<T, RefCount> makeIntrusive(Args &&...args);
+
+    mutable std::atomic<std::uint32_t> refCount_{0};
+    void (*destroy_)(const IntrusiveRefCounted *) noexcept = nullptr;
+
+  protected:
+    IntrusiveRefCounted() noexcept = default;
+
+    IntrusiveRefCounted(const IntrusiveRefCounted &) noexcept {}
+
+    IntrusiveRefCounted &operator=(const IntrusiveRefCounted &) noexcept { return *this; }
+
+    ~IntrusiveRefCounted() = default;
+
+  public:
+    /// Returns the number of the IntrusivePtr references to the object
+    std::uint32_t getRefCount() const noexcept { return refCount_.load(std::memory_order_relaxed); }
+};
+
+/**
+ * The single-word reference-counted handle of an object that derives from IntrusiveRefCounted (for example, an
+ * event). Unlike std::shared_ptr it has no control block: the counter is in the object, so a copy touches one
+ * cache line.
+ *
+ * The handles are created by makeIntrusive() or ObjectPool<T>::makeIntrusive() and are copied or converted
+ * (staticCast(), fastAs()) from the existing ones. There is no public constructor from a raw pointer, because an
+ * object that was not created by these functions can't be destroyed by the handle.
+ *
+ * @tparam T The object type
+ * @tparam RefCount The reference counting policy: AtomicRefCount (default) or LocalRefCount
+ */
+template <typename T, typename RefCount = AtomicRefCount> class IntrusivePtr final {
+    static_assert(std::is_base_of<IntrusiveRefCounted, T>::value, "T must derive from IntrusiveRefCounted");
+
+    template <typename, typename> friend class IntrusivePtr;
+    template <typename> friend class ObjectPool;
+
+    template <typename U, typename R, typename... Args> friend IntrusivePtr<U, R> makeIntrusive(Args &&...args);
+
+    T *ptr_ = nullptr;
+
+    // Creates the new reference to the object that is created by makeIntrusive() or ObjectPool<T>::makeIntrusive()
+    explicit IntrusivePtr(T *ptr) noexcept : ptr_{ptr} { addRef(); }
+
+    void addRef() const noexcept {
+        if (ptr_ != nullptr) {
+            RefCount::increment(ptr_->IntrusiveRefCounted::refCount_);
+        }
+    }
+
+    void release() noexcept {
+        if (ptr_ != nullptr) {
+            const IntrusiveRefCounted *object = ptr_;
+
+            if (RefCount::decrement(object->refCount_)) {
+                object->destroy_(object);
+            }
+        }
+    }
+
+  public:
+    /// The object type
+    using ElementType = T;
+
+    IntrusivePtr() noexcept = default;
+
+    IntrusivePtr(std::nullptr_t) noexcept {}
+
+    IntrusivePtr(const IntrusivePtr &other) noexcept : ptr_{other.ptr_} { addRef(); }
+
+    IntrusivePtr(IntrusivePtr &&other) noexcept : ptr_{other.ptr_} { other.ptr_ = nullptr; }
+
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U *, T *>::value>::type>
+    IntrusivePtr(const IntrusivePtr<U, RefCount> &other) noexcept : ptr_{other.ptr_} {
+        addRef();
+    }
+
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U *, T *>::value>::type>
+    IntrusivePtr(IntrusivePtr<U, RefCount> &&other) noexcept : ptr_{other.ptr_} {
+        other.ptr_ = nullptr;
+    }
+
+    IntrusivePtr &operator=(IntrusivePtr other) noexcept {
+        swap(other);
+
+        return *this;
+    }
+
+    ~IntrusivePtr() { release(); }
+
+    /**
+     * Returns the new reference to the object if it was created by makeIntrusive() or ObjectPool<T>::makeIntrusive()
+     * (like std::enable_shared_from_this::shared_from_this, but without the exception)
+     *
+     * @param object The pointer to the object
+     * @return The new handle of the object or an empty handle if the object is not held by handles
+     */
+    static IntrusivePtr fromObject(T *object) noexcept {
+        return object != nullptr && object->IntrusiveRefCounted::destroy_ != nullptr ? IntrusivePtr(object)
+                                                                                     : IntrusivePtr{};
+    }
+
+    ///
+    void swap(IntrusivePtr &other) noexcept { std::swap(ptr_, other.ptr_); }
+
+    /// Releases the reference
+    void reset() noexcept { IntrusivePtr{}.swap(*this); }
+
+    ///
+    T *get() const noexcept { return ptr_; }
+
+    ///
+    T &operator*() const noexcept { return *ptr_; }
+
+    ///
+    T *operator->() const noexcept { return ptr_; }
+
+    ///
+    explicit operator bool() const noexcept { return ptr_ != nullptr; }
+
+    /**
+     * Converts the handle statically (the object must be U). An empty handle is converted to an empty one.
+     *
+     * @tparam U The target type
+     * @return The new reference
+     */
+    template <typename U> IntrusivePtr<U, RefCount> staticCast() const noexcept {
+        return IntrusivePtr<U, RefCount>(static_cast<U *>(ptr_));
+    }
+
+    template <typename U> bool operator==(const IntrusivePtr<U, RefCount> &other) const noexcept {
+        return ptr_ == other.get();
+    }
+
+    template <typename U> bool operator!=(const IntrusivePtr<U, RefCount> &other) const noexcept {
+        return ptr_ != other.get();
+    }
+
+    bool operator==(std::nullptr_t) const noexcept { return ptr_ == nullptr; }
+
+    bool operator!=(std::nullptr_t) const noexcept { return ptr_ != nullptr; }
+};
+
+/// The handle for single-thread pipelines (see LocalRefCount)
+template <typename T> using LocalIntrusivePtr = IntrusivePtr<T, LocalRefCount>;
+
+/**
+ * Creates the object on the heap and returns the first handle of it
+ *
+ * @tparam T The object type
+ * @tparam RefCount The reference counting policy
+ * @tparam Args The types of the arguments of the constructor of T
+ * @param args The arguments of the constructor of T
+ * @return The handle
+ */
+template <typename T, typename RefCount, typename... Args> IntrusivePtr<T, RefCount> makeIntrusive(Args &&...args) {
+    auto object = new T(std::forward<Args>(args)...);
+
+    object->IntrusiveRefCounted::destroy_ = [](const IntrusiveRefCounted *o) noexcept {
+        delete static_cast<const T *>(o);
+    };
+
+    return IntrusivePtr<T, RefCount>(object);
+}
+
+/**
+ * Creates the std::shared_ptr that holds the handle. It is meant for the code that accepts std::shared_ptr only, the
+ * object is released when both the handle and all the shared pointers are released.
+ *
+ * @tparam T The object type
+ * @tparam RefCount The reference counting policy
+ * @param handle The handle
+ * @return The shared pointer to the same object
+ */
+template <typename T, typename RefCount> std::shared_ptr<T> toSharedPtr(IntrusivePtr<T, RefCount> handle) {
+    auto ptr = handle.get();
+
+    if (ptr == nullptr) {
+        return {};
+    }
+
+    return std::shared_ptr<T>(ptr, [handle](T *) mutable { handle.reset(); });
+}
+
+} // namespace dxfcpp
+
+namespace std {
+
+template <typename T, typename RefCount> struct hash<dxfcpp::IntrusivePtr<T, RefCount>> {
+    std::size_t operator()(const dxfcpp::IntrusivePtr<T, RefCount> &ptr) const noexcept {
+        return std::hash<T *>{}(ptr.get());
+    }
+};
+
+} // namespace std
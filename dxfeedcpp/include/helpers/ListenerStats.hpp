@@ -0,0 +1,109 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+#include "common/DXFCppConfig.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace dxfcpp {
+
+/// The snapshot of the execution time statistics of a listener
+struct ListenerStats {
+    /// The number of the buckets of the histogram
+    static DXFCPP_USE_CONSTEXPR std::size_t HISTOGRAM_SIZE = 24;
+
+    /// The listener id
+    std::size_t id = 0;
+
+    /// The number of invocations
+    std::uint64_t invocations = 0;
+
+    /// The total execution time in nanoseconds
+    std::uint64_t totalNanos = 0;
+
+    /// The maximal execution time in nanoseconds
+    std::uint64_t maxNanos = 0;
+
+    /// The histogram of the execution time. The bucket 0 counts the invocations shorter than 1 us, the bucket i counts
+    /// the invocations from 2^(i-1) us to 2^i us, the last bucket counts all the longer invocations.
+    std::array<std::uint64_t, HISTOGRAM_SIZE> histogram{};
+
+    /**
+     * Returns the histogram bucket of the execution time
+     *
+     * @param nanos The execution time in nanoseconds
+     * @return The bucket index
+     */
+    static std::size_t getHistogramBucket(std::uint64_t nanos) {
+        std::size_t bucket = 0;
+
+        for (auto micros = nanos / 1000; micros != 0 && bucket < HISTOGRAM_SIZE - 1; micros >>= 1) {
+            bucket++;
+        }
+
+        return bucket;
+    }
+};
+
+/// The thread-safe collector of the execution time statistics of a listener
+class ListenerStatsCollector {
+    std::atomic<std::uint64_t> invocations_{};
+    std::atomic<std::uint64_t> totalNanos_{};
+    std::atomic<std::uint64_t> maxNanos_{};
+    std::array<std::atomic<std::uint64_t>, ListenerStats::HISTOGRAM_SIZE> histogram_;
+
+  public:
+    ListenerStatsCollector() {
+        for (auto &bucket : histogram_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ListenerStatsCollector(const ListenerStatsCollector &) = delete;
+    ListenerStatsCollector &operator=(const ListenerStatsCollector &) = delete;
+
+    /**
+     * Records an invocation
+     *
+     * @param nanos The execution time in nanoseconds
+     */
+    void record(std::uint64_t nanos) {
+        invocations_.fetch_add(1, std::memory_order_relaxed);
+        totalNanos_.fetch_add(nanos, std::memory_order_relaxed);
+        histogram_[ListenerStats::getHistogramBucket(nanos)].fetch_add(1, std::memory_order_relaxed);
+
+        auto max = maxNanos_.load(std::memory_order_relaxed);
+
+        while (nanos > max && !maxNanos_.compare_exchange_weak(max, nanos, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * Returns the snapshot of the statistics (the counters are read one by one, so the snapshot is not atomic)
+     *
+     * @param id The listener id
+     * @return The snapshot
+     */
+    ListenerStats getSnapshot(std::size_t id) const {
+        ListenerStats result{};
+
+        result.id = id;
+        result.invocations = invocations_.load(std::memory_order_relaxed);
+        result.totalNanos = totalNanos_.load(std::memory_order_relaxed);
+        result.maxNanos = maxNanos_.load(std::memory_order_relaxed);
+
+        for (std::size_t i = 0; i < ListenerStats::HISTOGRAM_SIZE; i++) {
+            result.histogram[i] = histogram_[i].load(std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+};
+
+} // namespace dxfcpp
@@ -0,0 +1,160 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+#include "common/DXFCppConfig.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace dxfcpp {
+
+/**
+ * A bounded lock-free multi-producer/single-consumer ring buffer (D. Vyukov's bounded queue).
+ *
+ * Producers never take a lock and never allocate: an enqueue is one CAS on the tail position plus a release store into
+ * the cell. If the queue is full, tryPush returns false immediately and the caller decides what to do (see Handler).
+ * The capacity is rounded up to a power of two.
+ *
+ * tryPop is also safe to call concurrently, which allows producers to evict the oldest element.
+ *
+ * @tparam T The element type (must be move constructible)
+ */
+template <typename T> class MPSCQueue final {
+    static DXFCPP_USE_CONSTEXPR std::size_t CACHE_LINE_SIZE = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence{};
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        T *get() { return reinterpret_cast<T *>(&storage); }
+    };
+
+    static std::size_t roundUpToPowerOfTwo(std::size_t value) {
+        std::size_t result = 1;
+
+        while (result < value) {
+            result <<= 1;
+        }
+
+        return result;
+    }
+
+    const std::size_t mask_;
+    const std::unique_ptr<Cell[]> cells_;
+
+    // The padding keeps producers' and consumer's positions in different cache lines (alignas would require an
+    // aligned operator new, which is C++17).
+    char padding0_[CACHE_LINE_SIZE]{};
+    std::atomic<std::size_t> enqueuePosition_{0};
+    char padding1_[CACHE_LINE_SIZE]{};
+    std::atomic<std::size_t> dequeuePosition_{0};
+    char padding2_[CACHE_LINE_SIZE]{};
+
+  public:
+    /**
+     * Creates the new queue
+     *
+     * @param capacity The minimal capacity of the queue (will be rounded up to a power of two)
+     */
+    explicit MPSCQueue(std::size_t capacity)
+        : mask_{roundUpToPowerOfTwo(capacity < 2 ? 2 : capacity) - 1}, cells_{new Cell[mask_ + 1]} {
+        for (std::size_t i = 0; i <= mask_; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPSCQueue(const MPSCQueue &) = delete;
+    MPSCQueue &operator=(const MPSCQueue &) = delete;
+
+    /// Destroys the elements that were not taken
+    ~MPSCQueue() {
+        while (tryPop([](T &&) {})) {
+        }
+    }
+
+    /// Returns the capacity of the queue
+    std::size_t capacity() const { return mask_ + 1; }
+
+    /**
+     * Tries to put the element to the queue
+     *
+     * @tparam U The element type
+     * @param value The element
+     * @return false if the queue is full
+     */
+    template <typename U> bool tryPush(U &&value) {
+        Cell *cell = nullptr;
+        std::size_t position = enqueuePosition_.load(std::memory_order_relaxed);
+
+        while (true) {
+            cell = &cells_[position & mask_];
+
+            std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+            if (diff == 0) {
+                if (enqueuePosition_.compare_exchange_weak(position, position + 1)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = enqueuePosition_.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (cell->get()) T(std::forward<U>(value));
+        cell->sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * Tries to take the oldest element from the queue. The cell is released before the consumer is called.
+     *
+     * @tparam Consumer The consumer type (any callable that accepts `T&&`)
+     * @param consumer The consumer of the element
+     * @return false if the queue is empty (or the oldest element is not published yet)
+     */
+    template <typename Consumer> bool tryPop(Consumer &&consumer) {
+        Cell *cell = nullptr;
+        std::size_t position = dequeuePosition_.load(std::memory_order_relaxed);
+
+        while (true) {
+            cell = &cells_[position & mask_];
+
+            std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+
+            if (diff == 0) {
+                if (dequeuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = dequeuePosition_.load(std::memory_order_relaxed);
+            }
+        }
+
+        T value(std::move(*cell->get()));
+
+        cell->get()->~T();
+        cell->sequence.store(position + mask_ + 1, std::memory_order_release);
+        std::forward<Consumer>(consumer)(std::move(value));
+
+        return true;
+    }
+
+    /// Returns true if there are no claimed cells (the check is sequentially consistent with respect to tryPush)
+    bool empty() const { return enqueuePosition_.load() == dequeuePosition_.load(); }
+};
+
+} // namespace dxfcpp
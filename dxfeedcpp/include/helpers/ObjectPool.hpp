@@ -0,0 +1,319 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+#include "common/DXFCppConfig.hpp"
+
+#include "IntrusivePtr.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace dxfcpp {
+
+/// The snapshot of the statistics of an ObjectPool
+struct PoolStats {
+    /// The number of allocations that were served by the pool
+    std::uint64_t hits = 0;
+
+    /// The number of allocations that were served by the heap (each miss adds a block to the pool)
+    std::uint64_t misses = 0;
+
+    /// The number of the blocks that are allocated now
+    std::uint64_t live = 0;
+
+    /// The maximal number of the blocks that were allocated at the same time
+    std::uint64_t highWaterMark = 0;
+};
+
+/**
+ * A thread-safe pool of the shared objects of the type T (for example, events).
+ *
+ * The objects are created with std::allocate_shared, so the pool holds the blocks that contain both the object and
+ * the control block of the shared pointer. The freed blocks go to the cache of the current thread; full caches
+ * return the blocks to the global free list in batches, and empty caches take the blocks from it in batches. So in
+ * the steady state, when one thread creates the objects and others release them, the pool does not call the heap and
+ * takes the global lock once per batch.
+ *
+ * The blocks are never returned to the heap.
+ *
+ * @tparam T The type of the pooled objects
+ */
+template <typename T> class ObjectPool final {
+    // The maximal number of the blocks in the cache of a thread
+    static DXFCPP_USE_CONSTEXPR std::size_t CACHE_SIZE = 256;
+
+    // The number of the blocks that are moved between the caches and the global free list at once
+    static DXFCPP_USE_CONSTEXPR std::size_t BATCH_SIZE = 64;
+
+    struct Counters {
+        alignas(64) std::atomic<std::uint64_t> hits{};
+        std::atomic<std::uint64_t> misses{};
+        alignas(64) std::atomic<std::uint64_t> live{};
+        std::atomic<std::uint64_t> highWaterMark{};
+    };
+
+    static Counters &getCounters() {
+        static Counters counters{};
+
+        return counters;
+    }
+
+    // The free blocks of the specified size
+    template <std::size_t Size> class Blocks final {
+        struct Node {
+            Node *next;
+        };
+
+        static DXFCPP_USE_CONSTEXPR std::size_t BLOCK_SIZE = Size < sizeof(Node) ? sizeof(Node) : Size;
+
+        struct FreeList {
+            Node *head = nullptr;
+            std::size_t count = 0;
+
+            void push(void *block) {
+                auto node = static_cast<Node *>(block);
+
+                node->next = head;
+                head = node;
+                count++;
+            }
+
+            void *pop() {
+                auto node = head;
+
+                head = node->next;
+                count--;
+
+                return node;
+            }
+
+            // Moves up to blocksCount blocks to the other list
+            void moveTo(FreeList &other, std::size_t blocksCount) {
+                while (head != nullptr && blocksCount-- > 0) {
+                    other.push(pop());
+                }
+            }
+        };
+
+        struct Global {
+            std::mutex mutex{};
+            FreeList blocks{};
+        };
+
+        struct Cache {
+            FreeList blocks{};
+
+            ~Cache() {
+                isCacheDestroyed() = true;
+
+                auto &global = getGlobal();
+                std::lock_guard<std::mutex> lock{global.mutex};
+
+                blocks.moveTo(global.blocks, blocks.count);
+            }
+        };
+
+        static Global &getGlobal() {
+            // The global list is never destroyed: the objects can be released during the static destruction.
+            static Global *global = new Global();
+
+            return *global;
+        }
+
+        // Objects can be released by a thread after the destruction of its cache (by other thread_local objects)
+        static bool &isCacheDestroyed() {
+            static thread_local bool destroyed = false;
+
+            return destroyed;
+        }
+
+        static Cache &getCache() {
+            static thread_local Cache cache{};
+
+            return cache;
+        }
+
+      public:
+        static void *allocate() {
+            auto &counters = getCounters();
+            void *block = nullptr;
+
+            if (isCacheDestroyed()) {
+                auto &global = getGlobal();
+                std::lock_guard<std::mutex> lock{global.mutex};
+
+                if (global.blocks.head != nullptr) {
+                    block = global.blocks.pop();
+                }
+            } else {
+                auto &cache = getCache();
+
+                if (cache.blocks.head == nullptr) {
+                    auto &global = getGlobal();
+                    std::lock_guard<std::mutex> lock{global.mutex};
+
+                    global.blocks.moveTo(cache.blocks, BATCH_SIZE);
+                }
+
+                if (cache.blocks.head != nullptr) {
+                    block = cache.blocks.pop();
+                }
+            }
+
+            if (block != nullptr) {
+                counters.hits.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                block = ::operator new(BLOCK_SIZE);
+                counters.misses.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            auto live = counters.live.fetch_add(1, std::memory_order_relaxed) + 1;
+            auto max = counters.highWaterMark.load(std::memory_order_relaxed);
+
+            while (live > max && !counters.highWaterMark.compare_exchange_weak(max, live, std::memory_order_relaxed)) {
+            }
+
+            return block;
+        }
+
+        static void deallocate(void *block) noexcept {
+            getCounters().live.fetch_sub(1, std::memory_order_relaxed);
+
+            if (isCacheDestroyed()) {
+                auto &global = getGlobal();
+                std::lock_guard<std::mutex> lock{global.mutex};
+
+                global.blocks.push(block);
+
+                return;
+            }
+
+            auto &cache = getCache();
+
+            cache.blocks.push(block);
+
+            if (cache.blocks.count > CACHE_SIZE) {
+                auto &global = getGlobal();
+                std::lock_guard<std::mutex> lock{global.mutex};
+
+                cache.blocks.moveTo(global.blocks, BATCH_SIZE);
+            }
+        }
+    };
+
+  public:
+    /**
+     * The allocator that takes the blocks from the pool. It is meant for std::allocate_shared, so the arrays are
+     * allocated by the heap.
+     *
+     * @tparam U The type of the allocated objects (for example, the control block of std::shared_ptr<T>)
+     */
+    template <typename U> struct Allocator {
+        ///
+        using value_type = U;
+
+        ///
+        template <typename V> struct rebind {
+            ///
+            using other = Allocator<V>;
+        };
+
+        static_assert(alignof(U) <= alignof(std::max_align_t), "Over-aligned types are not supported by ObjectPool");
+
+        Allocator() noexcept = default;
+
+        template <typename V> Allocator(const Allocator<V> &) noexcept {}
+
+        ///
+        U *allocate(std::size_t n) {
+            if (n != 1) {
+                return static_cast<U *>(::operator new(n * sizeof(U)));
+            }
+
+            return static_cast<U *>(Blocks<sizeof(U)>::allocate());
+        }
+
+        ///
+        void deallocate(U *p, std::size_t n) noexcept {
+            if (n != 1) {
+                ::operator delete(p);
+
+                return;
+            }
+
+            Blocks<sizeof(U)>::deallocate(p);
+        }
+
+        template <typename V> bool operator==(const Allocator<V> &) const noexcept { return true; }
+
+        template <typename V> bool operator!=(const Allocator<V> &) const noexcept { return false; }
+    };
+
+    /**
+     * Creates the shared object in a block of the pool
+     *
+     * @tparam Args The types of the arguments of the constructor of T
+     * @param args The arguments of the constructor of T
+     * @return The shared pointer to the new object
+     */
+    template <typename... Args> static std::shared_ptr<T> makeShared(Args &&...args) {
+        return std::allocate_shared<T>(Allocator<T>{}, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Creates the object in a block of the pool and returns the first handle of it. The block is returned to the pool
+     * when the last handle is released.
+     *
+     * @tparam RefCount The reference counting policy of the handle (AtomicRefCount or LocalRefCount)
+     * @tparam Args The types of the arguments of the constructor of T
+     * @param args The arguments of the constructor of T
+     * @return The handle
+     */
+    template <typename RefCount = AtomicRefCount, typename... Args>
+    static IntrusivePtr<T, RefCount> makeIntrusive(Args &&...args) {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported by ObjectPool");
+
+        auto block = Blocks<sizeof(T)>::allocate();
+        T *object = nullptr;
+
+        try {
+            object = new (block) T(std::forward<Args>(args)...);
+        } catch (...) {
+            Blocks<sizeof(T)>::deallocate(block);
+
+            throw;
+        }
+
+        object->IntrusiveRefCounted::destroy_ = [](const IntrusiveRefCounted *o) noexcept {
+            auto t = static_cast<const T *>(o);
+
+            t->~T();
+            Blocks<sizeof(T)>::deallocate(const_cast<T *>(t));
+        };
+
+        return IntrusivePtr<T, RefCount>(object);
+    }
+
+    /// Returns the snapshot of the statistics of the pool (the counters are read one by one)
+    static PoolStats getStats() {
+        auto &counters = getCounters();
+        PoolStats result{};
+
+        result.hits = counters.hits.load(std::memory_order_relaxed);
+        result.misses = counters.misses.load(std::memory_order_relaxed);
+        result.live = counters.live.load(std::memory_order_relaxed);
+        result.highWaterMark = counters.highWaterMark.load(std::memory_order_relaxed);
+
+        return result;
+    }
+};
+
+} // namespace dxfcpp
@@ -0,0 +1,127 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+#include "common/DXFCppConfig.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace dxfcpp {
+
+/**
+ * An atomic pointer to an immutable snapshot with RCU (read-copy-update) semantics.
+ *
+ * Readers take no lock and do not allocate: a read section is two atomic increments/decrements of a reader counter and
+ * an atomic load of the pointer. Writers are serialized, build a new snapshot from the current one, publish it and
+ * retire the old one. Writers never wait for readers: a retired snapshot is deleted by a later update (or by the
+ * destructor) once the grace period has passed, i.e. once the epoch has been advanced twice since the retirement. The
+ * epoch is advanced only when no reader is left in the counter of the previous epoch, so a slow reader delays the
+ * reclamation, but not the writers. A reader may update the pointer too.
+ *
+ * @tparam T The snapshot type
+ */
+template <typename T> class RcuPointer final {
+    std::atomic<const T *> current_;
+    mutable std::atomic<std::size_t> epoch_{0};
+    mutable std::atomic<std::size_t> readers_[2];
+
+    // Serializes the writers and the epoch advances. It is never taken by readers.
+    std::mutex writeMutex_{};
+    // The retired snapshots with the epochs of their retirement
+    std::vector<std::pair<std::size_t, std::unique_ptr<const T>>> retired_{};
+
+    struct ReadGuard {
+        std::atomic<std::size_t> &readers;
+
+        explicit ReadGuard(std::atomic<std::size_t> &r) : readers(r) { readers.fetch_add(1); }
+
+        ~ReadGuard() { readers.fetch_sub(1); }
+    };
+
+    // Must be called under the writeMutex_. Advances the epoch (at most twice) while the readers of the previous epoch
+    // have left. The readers that could see a snapshot retired at the epoch E are counted in the counters of E and
+    // E - 1 before the retirement, so the snapshot is unreachable when the epoch is E + 2.
+    void tryAdvanceEpoch() {
+        for (int i = 0; i < 2; i++) {
+            auto epoch = epoch_.load();
+
+            if (readers_[(epoch + 1) & 1].load() != 0) {
+                return;
+            }
+
+            epoch_.store(epoch + 1);
+        }
+    }
+
+  public:
+    /**
+     * Creates the pointer to the initial snapshot
+     *
+     * @param initial The initial snapshot
+     */
+    explicit RcuPointer(std::unique_ptr<const T> initial) : current_{initial.release()} {
+        readers_[0].store(0);
+        readers_[1].store(0);
+    }
+
+    RcuPointer(const RcuPointer &) = delete;
+    RcuPointer &operator=(const RcuPointer &) = delete;
+
+    ~RcuPointer() { delete current_.load(); }
+
+    /**
+     * Calls the reader with the current snapshot. The snapshot stays alive until the reader returns.
+     *
+     * @tparam Reader The reader type (any callable that accepts `const T&`)
+     * @param reader The reader
+     */
+    template <typename Reader> void read(Reader &&reader) const {
+        ReadGuard guard{readers_[epoch_.load() & 1]};
+
+        std::forward<Reader>(reader)(*current_.load());
+    }
+
+    /**
+     * Replaces the snapshot by a new one built from the current snapshot. It does not wait for the readers: the old
+     * snapshot is retired and deleted by this or a later update when no reader can see it.
+     *
+     * @tparam Updater The updater type (any callable that accepts `const T&` and returns `std::unique_ptr<const T>`)
+     * @param updater The updater
+     */
+    template <typename Updater> void update(Updater &&updater) {
+        // The snapshots that are deleted outside the lock
+        std::vector<std::unique_ptr<const T>> garbage{};
+
+        {
+            std::lock_guard<std::mutex> lock{writeMutex_};
+
+            std::unique_ptr<const T> next = std::forward<Updater>(updater)(*current_.load());
+            std::unique_ptr<const T> old{current_.exchange(next.release())};
+
+            retired_.emplace_back(epoch_.load(), std::move(old));
+            tryAdvanceEpoch();
+
+            // The snapshots are retired in the order of the epochs
+            auto epoch = epoch_.load();
+            auto firstAlive = std::find_if(
+                retired_.begin(), retired_.end(),
+                [epoch](const std::pair<std::size_t, std::unique_ptr<const T>> &r) { return r.first + 2 > epoch; });
+
+            for (auto it = retired_.begin(); it != firstAlive; ++it) {
+                garbage.emplace_back(std::move(it->second));
+            }
+
+            retired_.erase(retired_.begin(), firstAlive);
+        }
+    }
+};
+
+} // namespace dxfcpp
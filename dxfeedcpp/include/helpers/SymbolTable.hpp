@@ -0,0 +1,330 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+#include "common/DXFCppConfig.hpp"
+
+#include "converters/StringConverter.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cwchar>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace dxfcpp {
+
+/// The error of interning a new symbol when the SymbolTable is full
+struct SymbolTableOverflowError final : public std::length_error {
+    SymbolTableOverflowError() : std::length_error("dxfcpp::SymbolTable: the limit of the symbols is reached") {}
+};
+
+/**
+ * A thread-safe process-wide table of interned event symbols.
+ *
+ * Each distinct symbol gets a stable 32-bit id, and the UTF-8 and the wide representations of the symbol are stored
+ * once. Interning a symbol that is already known is lock-free, does not allocate and does not transcode the symbol:
+ * the lookup probes an open-addressing index keyed by the hash of the C-API string. Only a new symbol takes the lock of
+ * its shard of the index. Getting the symbol by the id is lock-free.
+ *
+ * The table is process-wide (and is never destroyed), since events with symbol ids can outlive connections.
+ * Symbols are never removed. The table holds up to MAX_SYMBOLS_COUNT symbols. Interning a new symbol beyond the limit
+ * fails loudly with SymbolTableOverflowError. The symbols are not silently collapsed into the empty one, since they
+ * would share the delivery lane and the conflation key.
+ */
+class SymbolTable final {
+  public:
+    /// The symbol id type
+    using IdType = std::uint32_t;
+
+    /// The id of the empty symbol
+    static DXFCPP_USE_CONSTEXPR IdType EMPTY_SYMBOL_ID = 0;
+
+  private:
+    static DXFCPP_USE_CONSTEXPR std::size_t CHUNK_SIZE_BITS = 12;
+    static DXFCPP_USE_CONSTEXPR std::size_t CHUNK_SIZE = std::size_t{1} << CHUNK_SIZE_BITS;
+    static DXFCPP_USE_CONSTEXPR std::size_t MAX_CHUNKS_COUNT = 16384;
+    static DXFCPP_USE_CONSTEXPR std::size_t SHARDS_COUNT = 64;
+    static DXFCPP_USE_CONSTEXPR std::size_t INITIAL_INDEX_CAPACITY = 16;
+    static DXFCPP_USE_CONSTEXPR std::size_t SYMBOL_BUFFER_SIZE = 256;
+
+  public:
+    /// The maximal number of the symbols (including the empty one)
+    static DXFCPP_USE_CONSTEXPR std::size_t MAX_SYMBOLS_COUNT = CHUNK_SIZE * MAX_CHUNKS_COUNT;
+
+  private:
+    struct Entry {
+        std::wstring wideSymbol{};
+        std::string symbol{};
+    };
+
+    // The entries are allocated by chunks that are never moved, so the references to the entries are stable.
+    struct Chunk {
+        Entry entries[CHUNK_SIZE];
+    };
+
+    // The open-addressing (linear probing) index of the ids by the hash of the symbol. A slot is the upper half of the
+    // hash and the id + 1 (0 is an empty slot). The slots are written only under the mutex of the shard and are
+    // published by the release stores, so the readers probe them without the lock.
+    struct Index {
+        const std::size_t capacity;
+        const std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+        std::size_t size = 0;
+
+        explicit Index(std::size_t c) : capacity{c}, slots{new std::atomic<std::uint64_t>[c]} {
+            for (std::size_t i = 0; i < capacity; i++) {
+                slots[i].store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    struct Shard {
+        std::mutex mutex{};
+        std::atomic<Index *> index{nullptr};
+        // All the indexes of the shard: the replaced ones are kept, since the readers can still probe them
+        std::vector<std::unique_ptr<Index>> indexes{};
+    };
+
+    const std::unique_ptr<std::atomic<Chunk *>[]> chunks_;
+    std::mutex chunksMutex_{};
+    std::atomic<IdType> nextId_{0};
+    Shard shards_[SHARDS_COUNT];
+
+    // FNV-1a over the code units
+    static std::uint64_t hash(const wchar_t *symbol, std::size_t length) {
+        std::uint64_t result = 14695981039346656037ULL;
+
+        for (std::size_t i = 0; i < length; i++) {
+            result = (result ^ static_cast<std::uint64_t>(symbol[i])) * 1099511628211ULL;
+        }
+
+        return result;
+    }
+
+    // The lower bits of the hash select the shard, so the probing starts from the next ones
+    static std::size_t getSlotIndex(std::uint64_t symbolHash, std::size_t capacity) {
+        return static_cast<std::size_t>(symbolHash / SHARDS_COUNT) & (capacity - 1);
+    }
+
+    static std::uint64_t makeSlot(std::uint64_t symbolHash, IdType id) {
+        return (symbolHash & 0xFFFFFFFF00000000ULL) | (static_cast<std::uint64_t>(id) + 1);
+    }
+
+    static IdType getSlotId(std::uint64_t slot) { return static_cast<IdType>((slot & 0xFFFFFFFFULL) - 1); }
+
+    // Finds the id of the symbol in the index. Returns false if the index has no such symbol.
+    bool find(const Index &index, std::uint64_t symbolHash, const wchar_t *symbol, std::size_t length,
+              IdType &id) const {
+        for (auto i = getSlotIndex(symbolHash, index.capacity);; i = (i + 1) & (index.capacity - 1)) {
+            auto slot = index.slots[i].load(std::memory_order_acquire);
+
+            if (slot == 0) {
+                return false;
+            }
+
+            if (((slot ^ symbolHash) & 0xFFFFFFFF00000000ULL) != 0) {
+                continue;
+            }
+
+            auto candidate = getSlotId(slot);
+            const auto &wideSymbol = findEntry(candidate)->wideSymbol;
+
+            if (wideSymbol.size() == length && std::wmemcmp(wideSymbol.data(), symbol, length) == 0) {
+                id = candidate;
+
+                return true;
+            }
+        }
+    }
+
+    // Must be called under the mutex of the shard
+    static void insert(Index &index, std::uint64_t symbolHash, IdType id) {
+        auto i = getSlotIndex(symbolHash, index.capacity);
+
+        while (index.slots[i].load(std::memory_order_relaxed) != 0) {
+            i = (i + 1) & (index.capacity - 1);
+        }
+
+        index.slots[i].store(makeSlot(symbolHash, id), std::memory_order_release);
+        index.size++;
+    }
+
+    // Must be called under the mutex of the shard. Keeps the load factor of the index not greater than 1/2.
+    Index &reserve(Shard &shard) {
+        auto index = shard.index.load(std::memory_order_relaxed);
+
+        if ((index->size + 1) * 2 <= index->capacity) {
+            return *index;
+        }
+
+        std::unique_ptr<Index> grown{new Index(index->capacity * 2)};
+
+        for (std::size_t i = 0; i < index->capacity; i++) {
+            auto slot = index->slots[i].load(std::memory_order_relaxed);
+
+            if (slot != 0) {
+                const auto &wideSymbol = findEntry(getSlotId(slot))->wideSymbol;
+
+                insert(*grown, hash(wideSymbol.data(), wideSymbol.size()), getSlotId(slot));
+            }
+        }
+
+        shard.indexes.push_back(std::move(grown));
+        shard.index.store(shard.indexes.back().get(), std::memory_order_release);
+
+        return *shard.indexes.back();
+    }
+
+    SymbolTable() : chunks_{new std::atomic<Chunk *>[MAX_CHUNKS_COUNT]} {
+        for (std::size_t i = 0; i < MAX_CHUNKS_COUNT; i++) {
+            chunks_[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        for (auto &shard : shards_) {
+            shard.indexes.emplace_back(new Index(INITIAL_INDEX_CAPACITY));
+            shard.index.store(shard.indexes.back().get(), std::memory_order_release);
+        }
+
+        intern(L"");
+    }
+
+    const Entry *findEntry(IdType id) const {
+        auto chunk = chunks_[(id >> CHUNK_SIZE_BITS) % MAX_CHUNKS_COUNT].load(std::memory_order_acquire);
+
+        return chunk == nullptr ? nullptr : &chunk->entries[id & (CHUNK_SIZE - 1)];
+    }
+
+    // Must be called under the mutex of the symbol's shard
+    IdType add(const wchar_t *symbol, std::size_t length) {
+        auto id = nextId_.load(std::memory_order_relaxed);
+
+        while (true) {
+            if ((id >> CHUNK_SIZE_BITS) >= MAX_CHUNKS_COUNT) {
+                throw SymbolTableOverflowError();
+            }
+
+            if (nextId_.compare_exchange_weak(id, id + 1)) {
+                break;
+            }
+        }
+
+        auto &chunk = chunks_[id >> CHUNK_SIZE_BITS];
+
+        if (chunk.load(std::memory_order_acquire) == nullptr) {
+            std::lock_guard<std::mutex> lock{chunksMutex_};
+
+            if (chunk.load(std::memory_order_relaxed) == nullptr) {
+                chunk.store(new Chunk(), std::memory_order_release);
+            }
+        }
+
+        auto &entry = chunk.load(std::memory_order_acquire)->entries[id & (CHUNK_SIZE - 1)];
+
+        entry.wideSymbol.assign(symbol, length);
+        entry.symbol = StringConverter::wStringToUtf8(symbol, length);
+
+        return id;
+    }
+
+  public:
+    SymbolTable(const SymbolTable &) = delete;
+    SymbolTable &operator=(const SymbolTable &) = delete;
+
+    /// Returns the process-wide table
+    static SymbolTable &getInstance() {
+        // The table is intentionally never destroyed: events can be destroyed during the static destruction.
+        static SymbolTable *instance = new SymbolTable();
+
+        return *instance;
+    }
+
+    /**
+     * Interns the symbol
+     *
+     * @param symbol The symbol (for example, the C-API symbol)
+     * @return The symbol id
+     * @throws SymbolTableOverflowError if the symbol is new and the table already holds MAX_SYMBOLS_COUNT symbols
+     */
+    IdType intern(const wchar_t *symbol) {
+        if (symbol == nullptr) {
+            return EMPTY_SYMBOL_ID;
+        }
+
+        auto length = std::wcslen(symbol);
+        auto symbolHash = hash(symbol, length);
+        auto &shard = shards_[symbolHash % SHARDS_COUNT];
+        IdType id = EMPTY_SYMBOL_ID;
+
+        if (find(*shard.index.load(std::memory_order_acquire), symbolHash, symbol, length, id)) {
+            return id;
+        }
+
+        std::lock_guard<std::mutex> lock{shard.mutex};
+
+        // The symbol could be added (or the index could be replaced) after the lock-free lookup
+        if (find(*shard.index.load(std::memory_order_relaxed), symbolHash, symbol, length, id)) {
+            return id;
+        }
+
+        auto &index = reserve(shard);
+
+        id = add(symbol, length);
+        insert(index, symbolHash, id);
+
+        return id;
+    }
+
+    /**
+     * Interns the symbol
+     *
+     * @param symbol The UTF-8 symbol
+     * @return The symbol id
+     * @throws SymbolTableOverflowError if the symbol is new and the table already holds MAX_SYMBOLS_COUNT symbols
+     */
+    IdType intern(const std::string &symbol) {
+        wchar_t buffer[SYMBOL_BUFFER_SIZE];
+
+        if (StringConverter::getMaxWideLength(symbol.size()) < SYMBOL_BUFFER_SIZE) {
+            buffer[StringConverter::utf8ToWString(symbol.data(), symbol.size(), buffer)] = L'\0';
+
+            return intern(buffer);
+        }
+
+        return intern(StringConverter::utf8ToWString(symbol).c_str());
+    }
+
+    /**
+     * Returns the UTF-8 symbol by the id
+     *
+     * @param id The symbol id (the result of intern)
+     * @return The symbol. The reference is valid until the end of the process.
+     */
+    const std::string &getSymbol(IdType id) const {
+        auto entry = findEntry(id);
+
+        return entry == nullptr ? findEntry(EMPTY_SYMBOL_ID)->symbol : entry->symbol;
+    }
+
+    /**
+     * Returns the wide symbol by the id
+     *
+     * @param id The symbol id (the result of intern)
+     * @return The symbol. The reference is valid until the end of the process.
+     */
+    const std::wstring &getWSymbol(IdType id) const {
+        auto entry = findEntry(id);
+
+        return entry == nullptr ? findEntry(EMPTY_SYMBOL_ID)->wideSymbol : entry->wideSymbol;
+    }
+
+    /// Returns the number of the interned symbols (including the empty one)
+    std::size_t size() const { return nextId_.load(); }
+};
+
+} // namespace dxfcpp
@@ -0,0 +1,109 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+#include "common/DXFCppConfig.hpp"
+
+#if defined(__linux__) || defined(__APPLE__)
+#    include <pthread.h>
+#    include <sched.h>
+#endif
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace dxfcpp {
+
+/**
+ * The configuration of the threads that are created by the library: the workers of a Dispatcher and the threads of
+ * TimeSeriesSubscriptionFuture.
+ *
+ * The settings are applied by the threads themselves on start, best effort: a setting that is not supported by the
+ * platform or is not permitted (for example, SCHED_FIFO without CAP_SYS_NICE) is skipped.
+ * Linux supports all the settings, macOS supports the thread names only.
+ */
+struct ThreadingConfig {
+    /// The maximal length of a thread name (Linux limits the names to 16 bytes including the terminating zero)
+    static DXFCPP_USE_CONSTEXPR std::size_t MAX_THREAD_NAME_LENGTH = 15;
+
+    /// The number of the workers of the lowest (default) priority level of a dispatcher (0 means
+    /// Dispatcher::getDefaultThreadsCount())
+    std::size_t threadsCount = 0;
+
+    /// The number of the priority levels of a dispatcher (see Dispatcher::post)
+    std::size_t prioritiesCount = 2;
+
+    /// The number of the workers of each priority level except the lowest one
+    std::size_t priorityThreadsCount = 1;
+
+    /// The CPUs (cores) that the threads are allowed to run on. The empty set means no affinity
+    std::vector<std::size_t> cpus{};
+
+    /// If true, the i-th worker is pinned to the single CPU `cpus[i % cpus.size()]`, otherwise to the whole set. The
+    /// workers of the lowest priority level go first.
+    bool pinToSingleCpu = true;
+
+    /// The prefix of the thread names: workers of the lowest priority level are named "<prefix>-<index>", workers of
+    /// the other levels are named "<prefix>-p<level>-<index>"
+    std::string threadNamePrefix = "dxfcpp";
+
+    /// The SCHED_FIFO priority (1..99) of the threads. 0 means the default scheduling policy
+    int fifoPriority = 0;
+
+    /**
+     * Applies the configuration to the current thread
+     *
+     * @param nameSuffix The suffix of the thread name (the name is "<prefix>-<suffix>", truncated to
+     * MAX_THREAD_NAME_LENGTH)
+     * @param index The index of the thread that selects the CPU if pinToSingleCpu is true
+     * @return true if all the settings were applied
+     */
+    bool applyToCurrentThread(const std::string &nameSuffix, std::size_t index) const {
+        bool result = true;
+        auto name = (threadNamePrefix + "-" + nameSuffix).substr(0, MAX_THREAD_NAME_LENGTH);
+
+#if defined(__linux__)
+        result = pthread_setname_np(pthread_self(), name.c_str()) == 0 && result;
+
+        if (!cpus.empty()) {
+            cpu_set_t set;
+
+            CPU_ZERO(&set);
+
+            if (pinToSingleCpu) {
+                CPU_SET(cpus[index % cpus.size()], &set);
+            } else {
+                for (auto cpu : cpus) {
+                    CPU_SET(cpu, &set);
+                }
+            }
+
+            result = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 && result;
+        }
+
+        if (fifoPriority > 0) {
+            sched_param param{};
+
+            param.sched_priority = fifoPriority;
+            result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0 && result;
+        }
+#elif defined(__APPLE__)
+        (void)(index);
+
+        result = pthread_setname_np(name.c_str()) == 0;
+        result = result && cpus.empty() && fifoPriority <= 0;
+#else
+        (void)(index);
+        (void)(name);
+
+        result = cpus.empty() && fifoPriority <= 0;
+#endif
+
+        return result;
+    }
+};
+
+} // namespace dxfcpp
@@ -21,13 +21,36 @@ template <typename E> struct AbstractEventCheckingProcessor : AbstractEventProce
      */
     virtual void process(typename E::Ptr e) = 0;
 
+    /**
+     * Processes the event of type IntrusivePtr<E>. By default the handle is wrapped to the shared pointer
+     * (toSharedPtr() allocates a control block per event), the processors override this method to process the handles
+     * without the allocation.
+     *
+     * @param e The event
+     */
+    virtual void process(const IntrusivePtr<E> &e) { process(typename E::Ptr(toSharedPtr(e))); }
+
     /**
      * Tries to convert event pointer to pointer type to E and process it.
      *
      * @param e The event
      */
     void process(dxfcpp::Event::Ptr e) override {
-        auto event = e->sharedAs<E>();
+        auto event = e->fastAs<E>();
+
+        if (!event)
+            return;
+
+        process(event);
+    }
+
+    /**
+     * Tries to convert event handle to handle of type E (by the type tag, without allocation) and process it.
+     *
+     * @param e The event
+     */
+    void process(const dxfcpp::Event::Handle &e) override {
+        auto event = fastAs<E>(e);
 
         if (!event)
             return;
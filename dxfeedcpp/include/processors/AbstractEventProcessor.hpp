@@ -23,6 +23,15 @@ struct AbstractEventProcessor : dxfcpp::SharedEntity {
      */
     virtual void process(dxfcpp::Event::Ptr event) = 0;
 
+    /**
+     * Processes the event that is held by the intrusive handle. By default the handle is wrapped to the shared pointer
+     * (toSharedPtr() allocates a control block per event) and is passed to the process(Event::Ptr). The handle path is
+     * opt-in: only the processors that override this method process the handles without the allocation.
+     *
+     * @param event The dxFeed C++-API event handle
+     */
+    virtual void process(const dxfcpp::Event::Handle &event) { process(toSharedPtr(event)); }
+
     /// Returns a string representation of the entity
     std::string toString() const override {
         return std::string("AbstractEventProcessor{") + string::toHex((uint64_t)this) + "}";
@@ -43,6 +43,17 @@ class CompositeProcessor : virtual public AbstractEventProcessor {
             p->process(event);
         }
     }
+
+    /**
+     * Applies the event handle to processors
+     *
+     * @param event The dxFeed C++-API event handle
+     */
+    void process(const dxfcpp::Event::Handle &event) override {
+        for (const auto &p : processors_) {
+            p->process(event);
+        }
+    }
 };
 
 } // namespace dxfcpp
\ No newline at end of file
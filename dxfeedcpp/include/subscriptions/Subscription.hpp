@@ -9,23 +9,34 @@ extern "C" {
 #include <EventData.h>
 }
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
 #include <unordered_set>
 #include <vector>
 
 #include "common/DXFCppConfig.hpp"
 
 #include "events/Candle.hpp"
+#include "events/EventRegistry.hpp"
 #include "events/EventTraits.hpp"
 #include "events/EventType.hpp"
+#include "events/EventView.hpp"
 #include "events/Quote.hpp"
 #include "events/Summary.hpp"
 #include "events/Trade.hpp"
 
+#include "helpers/Dispatcher.hpp"
 #include "helpers/Handler.hpp"
+#include "helpers/ObjectPool.hpp"
 
 namespace dxfcpp {
 
@@ -39,7 +50,8 @@ template <class T> constexpr const T &clamp(const T &v, const T &lo, const T &hi
 
 /// Symbols buffer used to convert vector std::string symbols to wchar_t** symbols
 class Symbols {
-    std::vector<std::wstring> wSymbols_;
+    // The null-terminated wide symbols one after another
+    std::vector<wchar_t> buffer_;
     std::vector<const wchar_t *> rawWSymbols_;
 
   public:
@@ -56,14 +68,36 @@ class Symbols {
      * @param end The last iterator
      */
     template <typename It> Symbols(It begin, It end) {
-        std::transform(begin, end, std::back_inserter(wSymbols_),
-                       [](const std::string &s) { return StringConverter::utf8ToWString(s); });
-        std::transform(wSymbols_.begin(), wSymbols_.end(), std::back_inserter(rawWSymbols_),
-                       [](const std::wstring &s) { return s.c_str(); });
+        std::size_t size = 0;
+
+        for (auto it = begin; it != end; ++it) {
+            const std::string &symbol = *it;
+
+            size += StringConverter::getMaxWideLength(symbol.size()) + 1;
+        }
+
+        buffer_.resize(size);
+
+        std::vector<std::size_t> offsets{};
+        std::size_t offset = 0;
+
+        for (auto it = begin; it != end; ++it) {
+            const std::string &symbol = *it;
+
+            offsets.push_back(offset);
+            offset += StringConverter::utf8ToWString(symbol.data(), symbol.size(), buffer_.data() + offset);
+            buffer_[offset++] = L'\0';
+        }
+
+        rawWSymbols_.reserve(offsets.size());
+
+        for (auto symbolOffset : offsets) {
+            rawWSymbols_.push_back(buffer_.data() + symbolOffset);
+        }
     }
 
     /// Returns the vector of wstring symbols
-    const std::vector<std::wstring> &getWSymbols() const { return wSymbols_; }
+    std::vector<std::wstring> getWSymbols() const { return {rawWSymbols_.begin(), rawWSymbols_.end()}; }
 
     /// Returns the vector of const wchar_t* symbols
     const std::vector<const wchar_t *> &getRawWSymbols() const { return rawWSymbols_; }
@@ -73,18 +107,15 @@ struct Subscription;
 struct TimeSeriesSubscription;
 
 // A thread-safe wrapper class to hold dxf_subscription_t handle and manipulate symbols
-class SubscriptionImpl {
+class BasicSubscriptionImpl {
     mutable std::recursive_mutex mutex_{};
+
+  protected:
     dxf_subscription_t subscriptionHandle_ = nullptr;
     std::function<void(int /* eventType */, dxf_const_string_t /* symbolName */,
-                       const dxf_event_data_t * /* eventData */, int /*dataCount (always 1) */, void * /* userData */)>
+                       const dxf_event_data_t * /* eventData */, int /* dataCount */, void * /* userData */)>
         eventListener_{};
 
-    Handler<void(Event::Ptr)> onEvent_{1};
-
-    friend Subscription;
-    friend TimeSeriesSubscription;
-
     template <typename F> void safeCall(F &&f) {
         std::lock_guard<std::recursive_mutex> lock{mutex_};
 
@@ -93,15 +124,49 @@ class SubscriptionImpl {
         }
     }
 
-  public:
-    /// The synonym for a shared pointer to a SubscriptionImpl object
-    using Ptr = std::shared_ptr<SubscriptionImpl>;
-    // The synonym for a weak pointer to a SubscriptionImpl object
-    using WeakPtr = std::weak_ptr<SubscriptionImpl>;
+    BasicSubscriptionImpl() = default;
 
-    /// An invalid pointer that is returned if something went wrong. Usually, operations with an invalid pointer
-    /// do not give any result, since when trying to perform an operation, the handle is checked.
-    static const Ptr INVALID;
+    // Creates the event of the type E in the pool: the shared one or the intrusive one, depending on the pointer type
+    template <typename E, typename T>
+    static std::shared_ptr<T> createEvent(SymbolTable::IdType symbolId,
+                                          const typename EventTraits<E>::CApiEventType &data, std::shared_ptr<T> *) {
+        return ObjectPool<E>::makeShared(symbolId, data);
+    }
+
+    template <typename E, typename T, typename RefCount>
+    static IntrusivePtr<T, RefCount> createEvent(SymbolTable::IdType symbolId,
+                                                 const typename EventTraits<E>::CApiEventType &data,
+                                                 IntrusivePtr<T, RefCount> *) {
+        return ObjectPool<E>::template makeIntrusive<RefCount>(symbolId, data);
+    }
+
+    // Creates the event of the type E (EventPtr is std::shared_ptr or IntrusivePtr of E or of its base)
+    template <typename E, typename EventPtr = std::shared_ptr<E>>
+    static EventPtr createEvent(dxf_const_string_t symbolName, const typename EventTraits<E>::CApiEventType &data) {
+        return createEvent<E>(SymbolTable::getInstance().intern(symbolName), data, static_cast<EventPtr *>(nullptr));
+    }
+
+    // Creates the events of the type E from the C-API array of the events of one symbol. The symbol is interned once
+    // and the vector is reserved once per array (each event is still a separate pool allocation), so it can be passed
+    // to Handler::handleBatch as is.
+    template <typename E, typename EventPtr = std::shared_ptr<E>>
+    static std::vector<EventPtr> createEvents(dxf_const_string_t symbolName,
+                                              const typename EventTraits<E>::CApiEventType *data, std::size_t count) {
+        auto symbolId = SymbolTable::getInstance().intern(symbolName);
+        std::vector<EventPtr> result{};
+
+        result.reserve(count);
+
+        for (std::size_t i = 0; i < count; i++) {
+            result.emplace_back(createEvent<E>(symbolId, data[i], static_cast<EventPtr *>(nullptr)));
+        }
+
+        return result;
+    }
+
+  public:
+    BasicSubscriptionImpl(const BasicSubscriptionImpl &) = delete;
+    BasicSubscriptionImpl &operator=(const BasicSubscriptionImpl &) = delete;
 
     /// Tries to close the current subscription
     void close() {
@@ -114,10 +179,7 @@ class SubscriptionImpl {
     }
 
     /// RAII
-    ~SubscriptionImpl() { close(); }
-
-    /// Returns the onEvent handler that notifies all listeners asynchronously that the new event has been received
-    Handler<void(Event::Ptr)> &onEvent() { return onEvent_; }
+    virtual ~BasicSubscriptionImpl() { close(); }
 
     /**
      * Adds the symbol to subscription
@@ -250,52 +312,281 @@ class SubscriptionImpl {
     void clearSymbols() {
         safeCall([](dxf_subscription_t sub) { dxf_clear_symbols(sub); });
     }
+};
 
-    /// Creates the generic events listener that used by subscription wrappers.
-    static dxf_event_listener_t createEventListener() {
-        return [](int eventType, dxf_const_string_t symbolName, const dxf_event_data_t *eventData,
-                  int /*dataCount (always 1) */, void *userData) {
-            auto symbol = StringConverter::wStringToUtf8(symbolName);
+// A thread-safe wrapper class to hold dxf_subscription_t handle, manipulate symbols and notify the listeners of events
+class SubscriptionImpl : public BasicSubscriptionImpl {
+    Handler<void(Event::Ptr)> onEvent_{1};
+    Handler<void(Event::Handle)> onEventHandle_{1};
+
+    template <typename View> using ViewHandlerType = Handler<void(const View &)>;
+
+    // The views are valid only during the C-API callback, so the view handlers are always in the DeliveryMode::INLINE
+    // mode.
+    ViewHandlerType<QuoteView> onQuoteView_{1};
+    ViewHandlerType<TradeView> onTradeView_{1};
+    ViewHandlerType<TradeETHView> onTradeETHView_{1};
+    ViewHandlerType<CandleView> onCandleView_{1};
+
+    ViewHandlerType<QuoteView> &getViewHandler(const QuoteView *) { return onQuoteView_; }
+    ViewHandlerType<TradeView> &getViewHandler(const TradeView *) { return onTradeView_; }
+    ViewHandlerType<TradeETHView> &getViewHandler(const TradeETHView *) { return onTradeETHView_; }
+    ViewHandlerType<CandleView> &getViewHandler(const CandleView *) { return onCandleView_; }
+
+    // Passes the events to the listeners of the handler if there are any: a single event as is, an array through
+    // Handler::handleBatch (one call in the DeliveryMode::INLINE mode, enqueued event by event in the queued modes)
+    template <typename E, typename EventPtr>
+    static void handleEvents(Handler<void(EventPtr)> &handler, dxf_const_string_t symbolName,
+                             const typename EventTraits<E>::CApiEventType *data, std::size_t count) {
+        if (handler.isEmpty()) {
+            return;
+        }
+
+        if (count == 1) {
+            handler(createEvent<E, EventPtr>(symbolName, *data));
+        } else {
+            handler.handleBatch(createEvents<E, EventPtr>(symbolName, data, count));
+        }
+    }
+
+    // Passes the events to the onEvent and the onEventHandle listeners
+    template <typename E>
+    void handleEvents(dxf_const_string_t symbolName, const typename EventTraits<E>::CApiEventType *data,
+                      std::size_t count) {
+        handleEvents<E>(onEvent_, symbolName, data, count);
+        handleEvents<E>(onEventHandle_, symbolName, data, count);
+    }
+
+    // Calls the view listeners for each event of the array, then passes the owning events to the onEvent listeners
+    template <typename View>
+    void handle(dxf_const_string_t symbolName, const typename View::DataType *data, std::size_t count) {
+        auto &viewHandler = getViewHandler(static_cast<const View *>(nullptr));
+
+        if (!viewHandler.isEmpty()) {
+            for (std::size_t i = 0; i < count; i++) {
+                viewHandler(View{symbolName, data[i]});
+            }
+        }
+
+        handleEvents<typename View::EventType>(symbolName, data, count);
+    }
+
+    // Passes the C-API events of the type E to the view listeners (if E has the view) and to the event listeners
+    template <typename E>
+    static void dispatch(SubscriptionImpl &subscription, dxf_const_string_t symbolName,
+                         const dxf_event_data_t *eventData, std::size_t count) {
+        using CApiEventType = typename EventTraits<E>::CApiEventType;
+
+        dispatch<E>(subscription, symbolName, reinterpret_cast<const CApiEventType *>(eventData), count,
+                    std::integral_constant<bool, !std::is_void<typename EventTraits<E>::ViewType>::value>{});
+    }
+
+    template <typename E>
+    static void dispatch(SubscriptionImpl &subscription, dxf_const_string_t symbolName,
+                         const typename EventTraits<E>::CApiEventType *data, std::size_t count,
+                         std::true_type /* has the view */) {
+        subscription.handle<typename EventTraits<E>::ViewType>(symbolName, data, count);
+    }
+
+    template <typename E>
+    static void dispatch(SubscriptionImpl &subscription, dxf_const_string_t symbolName,
+                         const typename EventTraits<E>::CApiEventType *data, std::size_t count,
+                         std::false_type /* has the view */) {
+        subscription.handleEvents<E>(symbolName, data, count);
+    }
+
+    // Selects the dispatch function of each event type for the EventRegistry table
+    struct DispatchSelector {
+        using FunctionType = void (*)(SubscriptionImpl &, dxf_const_string_t, const dxf_event_data_t *, std::size_t);
+
+        template <typename E> static DXFCPP_CONSTEXPR FunctionType get() { return &SubscriptionImpl::dispatch<E>; }
+    };
+
+    friend Subscription;
+    friend TimeSeriesSubscription;
 
-            switch (static_cast<unsigned>(eventType)) {
-            case DXF_ET_QUOTE: {
-                auto cApiQuote = *reinterpret_cast<const dxf_quote_t *>(eventData);
-                auto quote = std::make_shared<Quote>(symbol, cApiQuote);
+  public:
+    /// The synonym for a shared pointer to a SubscriptionImpl object
+    using Ptr = std::shared_ptr<SubscriptionImpl>;
+    // The synonym for a weak pointer to a SubscriptionImpl object
+    using WeakPtr = std::weak_ptr<SubscriptionImpl>;
+
+    /// An invalid pointer that is returned if something went wrong. Usually, operations with an invalid pointer
+    /// do not give any result, since when trying to perform an operation, the handle is checked.
+    static const Ptr INVALID;
+
+    /**
+     * Creates the new subscription wrapper
+     *
+     * @param dispatcher The dispatcher whose workers will notify the onEvent listeners
+     * @param shardsCount The number of delivery shards. Events are assigned to the shards by the hash of the symbol, so
+     * events of one symbol are delivered in order, while events of different symbols can be delivered in parallel.
+     */
+    explicit SubscriptionImpl(Dispatcher::Ptr dispatcher = Dispatcher::getDefault(), std::size_t shardsCount = 1)
+        : onEvent_{Handler<void(Event::Ptr)>::DEFAULT_QUEUE_SIZE, dispatcher, shardsCount,
+                   [](const Event::Ptr &event) { return std::hash<SymbolTable::IdType>{}(event->getEventSymbolId()); },
+                   [](const Event::Ptr &event) { return getConflationKey(*event); }},
+          onEventHandle_{
+              Handler<void(Event::Handle)>::DEFAULT_QUEUE_SIZE, std::move(dispatcher), shardsCount,
+              [](const Event::Handle &event) { return std::hash<SymbolTable::IdType>{}(event->getEventSymbolId()); },
+              [](const Event::Handle &event) { return getConflationKey(*event); }} {
+        onQuoteView_.setDeliveryMode(DeliveryMode::INLINE);
+        onTradeView_.setDeliveryMode(DeliveryMode::INLINE);
+        onTradeETHView_.setDeliveryMode(DeliveryMode::INLINE);
+        onCandleView_.setDeliveryMode(DeliveryMode::INLINE);
+    }
+
+    /**
+     * Returns the key that identifies the event for the conflation (OverflowPolicy::CONFLATE): the type and the symbol
+     * of the event, plus the index for indexed events. Only the latest event per key is kept.
+     *
+     * The key of the events of the #EventRegistry types is composed of their type tag, symbol id and index, so it is
+     * selected without allocations and RTTI. The events of other types (without the type tag) are told apart by the
+     * hash of their RTTI type.
+     *
+     * @param event The event
+     * @return The conflation key
+     */
+    static ConflationKey getConflationKey(const Event &event) {
+        auto typeTag = event.getTypeTag();
+
+        if (typeTag < EventRegistry::COUNT) {
+            return {(static_cast<std::uint64_t>(typeTag) << 32) | event.getEventSymbolId(),
+                    EventRegistry::getIndex(event)};
+        }
+
+        auto indexed = dynamic_cast<const Indexed *>(&event);
+
+        return {(static_cast<std::uint64_t>(typeid(event).hash_code()) << 32) | event.getEventSymbolId(),
+                indexed != nullptr ? indexed->getIndex() : 0};
+    }
+
+    /// Returns the key that identifies the event for the conflation (see above)
+    static ConflationKey getConflationKey(const Event::Ptr &event) { return getConflationKey(*event); }
+
+    /// RAII. The subscription is closed before the handlers are destroyed, so the C-API can't call them after that.
+    ~SubscriptionImpl() override { close(); }
+
+    /// Returns the onEvent handler that notifies all listeners asynchronously that the new event has been received.
+    /// The overflow policy of the handler (for example, conflation of the events) can be changed by
+    /// `onEvent().setOverflowPolicy(...)`
+    Handler<void(Event::Ptr)> &onEvent() { return onEvent_; }
+
+    /**
+     * Returns the handler that notifies the listeners of the events that are held by the intrusive handles
+     * (Event::Handle): a copy of a handle is one atomic increment of the counter inside the event, and there is no
+     * control block. The events are created for these listeners separately from the onEvent ones, and only while the
+     * handler has listeners.
+     *
+     * The delivery mode, the overflow policy and the polling are set by the handler itself (for example,
+     * `onEventHandle().setDeliveryMode(...)`). The handles can be converted by `fastAs<Quote>(handle)`.
+     */
+    Handler<void(Event::Handle)> &onEventHandle() { return onEventHandle_; }
+
+    /**
+     * Adds the batch listener of events. It receives a contiguous range of all the events that were queued since the
+     * previous wakeup of the delivery task (a burst), so processing costs can be amortized over the burst.
+     *
+     * @param listener The listener that accepts `const std::vector<Event::Ptr> &`
+     * @return The listener id (the listener can be removed by `onEvent().remove(id)`)
+     */
+    std::size_t onEvents(Handler<void(Event::Ptr)>::BatchListenerType &&listener) {
+        return onEvent_.addBatch(std::move(listener));
+    }
 
-                reinterpret_cast<SubscriptionImpl *>(userData)->onEvent_(quote);
-            } break;
+    /**
+     * Adds the listener of the non-owning views of the events (QuoteView, TradeView, TradeETHView or CandleView).
+     *
+     * The view listeners are called inline by the C-API thread, before the events are passed to the onEvent listeners,
+     * and the views are valid only during the call (a listener that needs to keep the event calls
+     * `view.materialize()`).
+     * The owning events are not created at all while the subscription has no onEvent listeners.
+     *
+     * @tparam View The view type
+     * @param listener The listener that accepts `const View &`
+     * @return The listener id (the listener can be removed by `removeViewListener<View>(id)`)
+     */
+    template <typename View> std::size_t onView(typename ViewHandlerType<View>::ListenerType &&listener) {
+        return getViewHandler(static_cast<const View *>(nullptr)).add(std::move(listener));
+    }
 
-            case DXF_ET_CANDLE: {
-                auto cApiCandle = *reinterpret_cast<const dxf_candle_t *>(eventData);
-                auto candle = std::make_shared<Candle>(symbol, cApiCandle);
+    /**
+     * Removes the listener of the views
+     *
+     * @tparam View The view type
+     * @param id The listener id
+     */
+    template <typename View> void removeViewListener(std::size_t id) {
+        getViewHandler(static_cast<const View *>(nullptr)).remove(id);
+    }
 
-                reinterpret_cast<SubscriptionImpl *>(userData)->onEvent_(candle);
-            } break;
+    /**
+     * Sets the delivery mode of the events to the onEvent listeners.
+     *
+     * DeliveryMode::INLINE is the zero-hop mode for latency-critical subscriptions: the listeners are called directly
+     * by the network thread of the connection, without queues, thread switches and locks (only the first event of a
+     * new symbol takes a lock of the SymbolTable to intern the symbol). The listeners must be fast and must not block,
+     * since the next events are not received until they return.
+     *
+     * In the DeliveryMode::POLL mode the events are queued, and the application delivers them by calling poll() or
+     * pollBusySpin() on its own thread.
+     *
+     * The mode should be set before the symbols are added.
+     *
+     * @param deliveryMode The delivery mode (the default one is DeliveryMode::ASYNC)
+     */
+    void setDeliveryMode(DeliveryMode deliveryMode) { onEvent_.setDeliveryMode(deliveryMode); }
 
-            case DXF_ET_TRADE: {
-                auto cApiTrade = *reinterpret_cast<const dxf_trade_t *>(eventData);
-                auto trade = std::make_shared<Trade>(symbol, cApiTrade);
+    /// Returns the delivery mode of the events to the onEvent listeners
+    DeliveryMode getDeliveryMode() const { return onEvent_.getDeliveryMode(); }
 
-                reinterpret_cast<SubscriptionImpl *>(userData)->onEvent_(trade);
-            } break;
+    /**
+     * Delivers the received events to the listeners by the current thread. The subscription must be in the
+     * DeliveryMode::POLL mode, in which the events are queued and no library thread delivers them.
+     *
+     * @param maxEvents The maximal number of events to deliver
+     * @return The number of the delivered events
+     */
+    std::size_t poll(std::size_t maxEvents = std::numeric_limits<std::size_t>::max()) {
+        return onEvent_.poll(maxEvents);
+    }
 
-            case DXF_ET_TRADE_ETH: {
-                auto cApiTradeEth = *reinterpret_cast<const dxf_trade_eth_t *>(eventData);
-                auto tradeEth = std::make_shared<TradeETH>(symbol, cApiTradeEth);
+    /**
+     * Busy-spins the current thread delivering the received events until the deadline (DeliveryMode::POLL).
+     *
+     * @tparam Clock The clock type
+     * @tparam Duration The duration type
+     * @param deadline The time point until which the events are polled
+     * @return The number of the delivered events
+     */
+    template <typename Clock, typename Duration>
+    std::size_t pollBusySpin(const std::chrono::time_point<Clock, Duration> &deadline) {
+        return onEvent_.pollBusySpin(deadline);
+    }
 
-                reinterpret_cast<SubscriptionImpl *>(userData)->onEvent_(tradeEth);
-            } break;
+    /// Creates the generic events listener that used by subscription wrappers.
+    static dxf_event_listener_t createEventListener() {
+        return [](int eventType, dxf_const_string_t symbolName, const dxf_event_data_t *eventData, int dataCount,
+                  void *userData) {
+            auto subscription = reinterpret_cast<SubscriptionImpl *>(userData);
 
-            case DXF_ET_SUMMARY: {
-                auto cApiSummary = *reinterpret_cast<const dxf_summary_t *>(eventData);
-                auto summary = std::make_shared<Summary>(symbol, cApiSummary);
+            if (dataCount <= 0) {
+                return;
+            }
 
-                reinterpret_cast<SubscriptionImpl *>(userData)->onEvent_(summary);
-            } break;
+            auto eventId = EventRegistry::getEventId(static_cast<unsigned>(eventType));
+            auto dispatchFunction = EventRegistry::getFunction<DispatchSelector>(eventId);
+
+            if (dispatchFunction == nullptr) {
+                return;
             }
 
-            // TODO: add events
-            return;
+            // The events of a symbol that can't be interned (the SymbolTable is full, it is reported once) are
+            // dropped: the exception must not cross the C-API.
+            try {
+                dispatchFunction(*subscription, symbolName, eventData, static_cast<std::size_t>(dataCount));
+            } catch (const SymbolTableOverflowError &) {
+            }
         };
     }
 };
@@ -320,10 +611,13 @@ struct Subscription final {
      *
      * @param connectionHandle The parent connection handle
      * @param eventTypesMask The flags mask of events to subscribe
+     * @param dispatcher The dispatcher whose workers will notify the onEvent listeners
+     * @param shardsCount The number of per-symbol delivery shards
      * @return A shared pointer to the new Subscription object or Subscription::INVALID
      */
-    static Ptr create(dxf_connection_t connectionHandle, const EventTypesMask &eventTypesMask) {
-        auto s = std::make_shared<SubscriptionImpl>();
+    static Ptr create(dxf_connection_t connectionHandle, const EventTypesMask &eventTypesMask,
+                      Dispatcher::Ptr dispatcher = Dispatcher::getDefault(), std::size_t shardsCount = 1) {
+        auto s = std::make_shared<SubscriptionImpl>(std::move(dispatcher), shardsCount);
         dxf_subscription_t subscriptionHandle = nullptr;
 
         auto r =
@@ -370,10 +664,12 @@ struct TimeSeriesSubscription {
      * @param connectionHandle The connection handle
      * @param eventTypesMask The event types mask to subscribe
      * @param fromTime The time from which data must be requested
+     * @param dispatcher The dispatcher whose workers will notify the onEvent listeners
      * @return A shared pointer to the new TimeSeriesSubscription object or TimeSeriesSubscription::INVALID
      */
-    static Ptr create(dxf_connection_t connectionHandle, const EventTypesMask &eventTypesMask, std::uint64_t fromTime) {
-        auto s = std::make_shared<SubscriptionImpl>();
+    static Ptr create(dxf_connection_t connectionHandle, const EventTypesMask &eventTypesMask, std::uint64_t fromTime,
+                      Dispatcher::Ptr dispatcher = Dispatcher::getDefault()) {
+        auto s = std::make_shared<SubscriptionImpl>(std::move(dispatcher));
         dxf_subscription_t subscriptionHandle = nullptr;
 
         auto onlyTimeSeries = eventTypesMask & EventTypesMask::TIME_SERIES;
@@ -465,12 +761,12 @@ template <typename E> struct TimeSeriesSubscriptionFuture {
          * @param e A pointer to the event
          */
         void applyEventData(Event::Ptr e) {
-            auto event = e->sharedAs<E>();
+            auto event = e->fastAs<E>();
 
             if (!event)
                 return;
 
-            typename E::Ptr copy = std::make_shared<E>(*event);
+            typename E::Ptr copy = ObjectPool<E>::makeShared(*event);
 
             std::unique_lock<std::mutex> lk(eventsMutex_);
 
@@ -516,7 +812,8 @@ template <typename E> struct TimeSeriesSubscriptionFuture {
 
     /**
      * Returns a future with an vector of TimeSeries of events that will be received as a result of subscribing for the
-     * specified type, symbol, and time from and to
+     * specified type, symbol, and time from and to. The thread that collects the events applies the ThreadingConfig of
+     * the connection's dispatcher (it is named "<prefix>-ts").
      *
      * @tparam Connection The type of parent connection
      * @param connection The parent connection
@@ -534,6 +831,11 @@ template <typename E> struct TimeSeriesSubscriptionFuture {
             std::launch::async,
             [](typename Connection::Ptr connection, const std::string &symbol, std::uint64_t fromTime,
                std::uint64_t toTime, long timeout) -> std::vector<typename E::Ptr> {
+                // The thread belongs to the connection, so it is configured as the threads of its dispatcher.
+                const auto &dispatcher = connection->getDispatcher();
+
+                dispatcher->getThreadingConfig().applyToCurrentThread("ts", dispatcher->getTotalThreadsCount());
+
                 // Checks that the event type is TimeSeries. Otherwise returns an empty vector.
                 if (!EventTraits<E>::isTimeSeriesEvent) {
                     return {};
@@ -0,0 +1,280 @@
+#pragma once
+
+#ifndef DXFEED_HPP_INCLUDED
+#    error Please include only the DXFeed.hpp header
+#endif
+
+extern "C" {
+#include <DXFeed.h>
+#include <EventData.h>
+}
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#include "common/DXFCppConfig.hpp"
+
+#include "events/EventRegistry.hpp"
+#include "events/EventTraits.hpp"
+
+#include "helpers/Dispatcher.hpp"
+#include "helpers/Handler.hpp"
+#include "helpers/ObjectPool.hpp"
+#include "helpers/SymbolTable.hpp"
+
+#include "utils/Utils.hpp"
+
+#include "Subscription.hpp"
+
+namespace dxfcpp {
+
+template <typename... Es> struct TypedSubscription;
+
+/**
+ * A thread-safe wrapper class to hold dxf_subscription_t handle, manipulate symbols and notify the listeners of the
+ * events of the types Es.
+ *
+ * The set of the event types is fixed at compile time, so the listeners are registered per concrete type by
+ * `on<E>()` (for example, `on<Quote>()`) and receive `Quote::Ptr` instead of `Event::Ptr`. The C-API events are
+ * converted by a compile-time table indexed by the C-API event id, without virtual calls and casts of the events. A
+ * listener of a type that is not in Es is a compile error.
+ *
+ * @tparam Es The event types (any of the EventRegistry::Types)
+ */
+template <typename... Es> class TypedSubscriptionImpl final : public BasicSubscriptionImpl {
+    static_assert(sizeof...(Es) > 0, "TypedSubscription requires at least one event type");
+    static_assert(EventTypesTraits<Es...>::areSpecialized, "TypedSubscription requires the specialized event types");
+
+  public:
+    /// The type of the handler that notifies the listeners of the events of the type E
+    template <typename E> using HandlerType = Handler<void(typename E::Ptr)>;
+
+  private:
+    using DispatchFunctionType = void (*)(TypedSubscriptionImpl &, dxf_const_string_t, const dxf_event_data_t *,
+                                          std::size_t);
+
+    // The handler is not movable, so the handlers are held by pointers
+    std::tuple<std::unique_ptr<HandlerType<Es>>...> handlers_;
+
+    friend TypedSubscription<Es...>;
+
+    template <typename E> static std::uint64_t getIndex(const typename E::Ptr &event, std::true_type) {
+        return event->getIndex();
+    }
+
+    template <typename E> static std::uint64_t getIndex(const typename E::Ptr &, std::false_type) { return 0; }
+
+    // The key of the event of the type E for the conflation: the symbol, plus the index for indexed events
+    template <typename E> static ConflationKey getConflationKey(const typename E::Ptr &event) {
+        return {event->getEventSymbolId(),
+                getIndex<E>(event, std::integral_constant<bool, EventTraits<E>::isIndexedEvent>{})};
+    }
+
+    template <typename E>
+    static std::unique_ptr<HandlerType<E>> createHandler(const Dispatcher::Ptr &dispatcher, std::size_t shardsCount) {
+        return std::unique_ptr<HandlerType<E>>(new HandlerType<E>(
+            HandlerType<E>::DEFAULT_QUEUE_SIZE, dispatcher, shardsCount,
+            [](const typename E::Ptr &event) { return std::hash<SymbolTable::IdType>{}(event->getEventSymbolId()); },
+            &TypedSubscriptionImpl::getConflationKey<E>));
+    }
+
+    // Converts the C-API events to the events of the type E and passes them to the listeners, if there are any: a
+    // single event as is, an array through Handler::handleBatch (see Handler::handleBatch for the queued modes)
+    template <typename E>
+    static void dispatch(TypedSubscriptionImpl &subscription, dxf_const_string_t symbolName,
+                         const dxf_event_data_t *eventData, std::size_t count) {
+        auto &handler = *std::get<meta::IndexOf<E, Es...>::value>(subscription.handlers_);
+
+        if (handler.isEmpty()) {
+            return;
+        }
+
+        auto data = reinterpret_cast<const typename EventTraits<E>::CApiEventType *>(eventData);
+
+        if (count == 1) {
+            handler(ObjectPool<E>::makeShared(SymbolTable::getInstance().intern(symbolName), *data));
+        } else {
+            handler.handleBatch(createEvents<E>(symbolName, data, count));
+        }
+    }
+
+    // Selects the dispatch function of each event type for the EventRegistry table (nullptr for the types not in Es)
+    struct DispatchSelector {
+        using FunctionType = DispatchFunctionType;
+
+        template <typename E> static DXFCPP_CONSTEXPR FunctionType get() {
+            return get<E>(std::integral_constant<bool, (meta::IndexOf<E, Es...>::value < sizeof...(Es))>{});
+        }
+
+        template <typename E> static DXFCPP_CONSTEXPR FunctionType get(std::true_type /* is in Es */) {
+            return &TypedSubscriptionImpl::dispatch<E>;
+        }
+
+        template <typename E> static DXFCPP_CONSTEXPR FunctionType get(std::false_type /* is in Es */) {
+            return nullptr;
+        }
+    };
+
+    template <std::size_t... Is> void setDeliveryMode(DeliveryMode deliveryMode, meta::IndexSequence<Is...>) {
+        using Expander = int[];
+
+        (void)Expander{0, (std::get<Is>(handlers_)->setDeliveryMode(deliveryMode), 0)...};
+    }
+
+    template <std::size_t... Is> std::size_t poll(std::size_t maxEvents, meta::IndexSequence<Is...>) {
+        using Expander = int[];
+        std::size_t result = 0;
+
+        // A handler can deliver more than requested (the conflated calls), so the rest is checked before each type
+        (void)Expander{0, (result < maxEvents ? result += std::get<Is>(handlers_)->poll(maxEvents - result) : 0, 0)...};
+
+        return result;
+    }
+
+  public:
+    /// The synonym for a shared pointer to a TypedSubscriptionImpl object
+    using Ptr = std::shared_ptr<TypedSubscriptionImpl>;
+    /// The synonym for a weak pointer to a TypedSubscriptionImpl object
+    using WeakPtr = std::weak_ptr<TypedSubscriptionImpl>;
+
+    /// The dxFeed C-API event mask of the subscription
+    static DXFCPP_USE_CONSTEXPR unsigned C_API_EVENT_MASK = EventTypesTraits<Es...>::cApiEventMask;
+
+    /**
+     * Creates the new subscription wrapper
+     *
+     * @param dispatcher The dispatcher whose workers will notify the listeners
+     * @param shardsCount The number of delivery shards of each event type. Events are assigned to the shards by the
+     * hash of the symbol, so events of one symbol are delivered in order.
+     */
+    explicit TypedSubscriptionImpl(const Dispatcher::Ptr &dispatcher = Dispatcher::getDefault(),
+                                   std::size_t shardsCount = 1)
+        : handlers_{createHandler<Es>(dispatcher, shardsCount)...} {}
+
+    /// RAII. The subscription is closed before the handlers are destroyed, so the C-API can't call them after that.
+    ~TypedSubscriptionImpl() override { close(); }
+
+    /**
+     * Returns the handler that notifies the listeners of the events of the type E. The overflow policy, the delivery
+     * mode and the priority can be set per type.
+     *
+     * @tparam E The event type (one of Es)
+     * @return The handler
+     */
+    template <typename E> HandlerType<E> &on() {
+        static_assert(meta::IndexOf<E, Es...>::value < sizeof...(Es), "The subscription does not include the type E");
+
+        return *std::get<meta::IndexOf<E, Es...>::value>(handlers_);
+    }
+
+    /**
+     * Sets the delivery mode of the events of all the types (see SubscriptionImpl::setDeliveryMode).
+     *
+     * @param deliveryMode The delivery mode (the default one is DeliveryMode::ASYNC)
+     */
+    void setDeliveryMode(DeliveryMode deliveryMode) {
+        setDeliveryMode(deliveryMode, meta::MakeIndexSequence<sizeof...(Es)>{});
+    }
+
+    /**
+     * Delivers the received events of all the types to the listeners by the current thread (DeliveryMode::POLL).
+     *
+     * @param maxEvents The maximal number of events to deliver (the conflated events can exceed it, see Handler::poll)
+     * @return The number of the delivered events
+     */
+    std::size_t poll(std::size_t maxEvents = std::numeric_limits<std::size_t>::max()) {
+        return poll(maxEvents, meta::MakeIndexSequence<sizeof...(Es)>{});
+    }
+
+    /// Creates the events listener that converts the C-API events by the compile-time table
+    static dxf_event_listener_t createEventListener() {
+        return [](int eventType, dxf_const_string_t symbolName, const dxf_event_data_t *eventData, int dataCount,
+                  void *userData) {
+            if (dataCount <= 0) {
+                return;
+            }
+
+            auto eventId = EventRegistry::getEventId(static_cast<unsigned>(eventType));
+            auto dispatchFunction = EventRegistry::getFunction<DispatchSelector>(eventId);
+
+            if (dispatchFunction == nullptr) {
+                return;
+            }
+
+            // The events of a symbol that can't be interned (the SymbolTable is full, it is reported once) are
+            // dropped: the exception must not cross the C-API.
+            try {
+                dispatchFunction(*reinterpret_cast<TypedSubscriptionImpl *>(userData), symbolName, eventData,
+                                 static_cast<std::size_t>(dataCount));
+            } catch (const SymbolTableOverflowError &) {
+            }
+        };
+    }
+};
+
+template <typename... Es> DXFCPP_USE_CONSTEXPR unsigned TypedSubscriptionImpl<Es...>::C_API_EVENT_MASK;
+
+/**
+ * The thread-safe wrapper class to create subscriptions to the events of the types Es (the event types mask is
+ * derived at compile time)
+ *
+ * @tparam Es The event types (any of the EventRegistry::Types)
+ */
+template <typename... Es> struct TypedSubscription final {
+    /// The synonym for a shared pointer to a TypedSubscription object
+    using Ptr = std::shared_ptr<TypedSubscriptionImpl<Es...>>;
+    /// The synonym for a weak pointer to a TypedSubscription object
+    using WeakPtr = std::weak_ptr<TypedSubscriptionImpl<Es...>>;
+
+    /// An invalid pointer that is returned if something went wrong. Usually, operations with an invalid pointer
+    /// do not give any result, since when trying to perform an operation, the handle is checked.
+    static const Ptr INVALID;
+
+    /**
+     * Creates the new subscription to the events of the types Es.
+     *
+     * @param connectionHandle The parent connection handle
+     * @param dispatcher The dispatcher whose workers will notify the listeners
+     * @param shardsCount The number of per-symbol delivery shards of each event type
+     * @return A shared pointer to the new TypedSubscription object or TypedSubscription::INVALID
+     */
+    static Ptr create(dxf_connection_t connectionHandle, const Dispatcher::Ptr &dispatcher = Dispatcher::getDefault(),
+                      std::size_t shardsCount = 1) {
+        auto s = std::make_shared<TypedSubscriptionImpl<Es...>>(dispatcher, shardsCount);
+        dxf_subscription_t subscriptionHandle = nullptr;
+
+        auto mask = static_cast<int>(TypedSubscriptionImpl<Es...>::C_API_EVENT_MASK);
+        auto r = dxf_create_subscription(connectionHandle, mask, &subscriptionHandle);
+
+        if (r == DXF_FAILURE) {
+            return INVALID;
+        }
+
+        auto eventListener = TypedSubscriptionImpl<Es...>::createEventListener();
+
+        r = dxf_attach_event_listener(subscriptionHandle, eventListener, reinterpret_cast<void *>(s.get()));
+
+        if (r == DXF_FAILURE) {
+            dxf_close_subscription(subscriptionHandle);
+
+            return INVALID;
+        }
+
+        s->subscriptionHandle_ = subscriptionHandle;
+        s->eventListener_ = eventListener;
+
+        return s;
+    }
+};
+
+template <typename... Es>
+const typename TypedSubscription<Es...>::Ptr TypedSubscription<Es...>::INVALID{new TypedSubscriptionImpl<Es...>{}};
+
+} // namespace dxfcpp
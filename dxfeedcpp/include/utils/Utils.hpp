@@ -6,11 +6,124 @@
 
 #include "common/DXFCppConfig.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <ostream>
 #include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace dxfcpp {
 
+namespace meta {
+
+/// A compile-time sequence of indices (std::index_sequence is not available in C++11)
+template <std::size_t... Is> struct IndexSequence {};
+
+/// Generates IndexSequence<0, 1, ..., N - 1>
+template <std::size_t N, std::size_t... Is> struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, Is...> {};
+
+template <std::size_t... Is> struct MakeIndexSequence<0, Is...> : IndexSequence<Is...> {};
+
+/// A compile-time list of types
+template <typename... Ts> struct TypeList {};
+
+/// The index of the first T in Ts (sizeof...(Ts) if there is no T in Ts)
+template <typename T, typename... Ts> struct IndexOf : std::integral_constant<std::size_t, 0> {};
+
+template <typename T, typename U, typename... Ts>
+struct IndexOf<T, U, Ts...> : std::integral_constant<std::size_t, 1 + IndexOf<T, Ts...>::value> {};
+
+template <typename T, typename... Ts> struct IndexOf<T, T, Ts...> : std::integral_constant<std::size_t, 0> {};
+
+/// Unpacks a tuple of arguments of a call: a one-argument call is represented by the argument itself
+template <typename... Ts> struct UnpackedTuple {
+    /// The type of the unpacked tuple
+    using Type = std::tuple<Ts...>;
+
+    /// Returns the unpacked tuple
+    static Type &&unpack(std::tuple<Ts...> &&tuple) { return std::move(tuple); }
+};
+
+template <typename T> struct UnpackedTuple<T> {
+    using Type = T;
+
+    static T &&unpack(std::tuple<T> &&tuple) { return std::get<0>(std::move(tuple)); }
+};
+
+} // namespace meta
+
+/**
+ * The non-owning constant view of a character sequence (std::string_view is not available in C++11). It is a literal
+ * type, so the names of the enum wrappers can be stored in the constexpr tables.
+ */
+class StringView final {
+    const char *data_;
+    std::size_t size_;
+
+  public:
+    /// Creates the empty view
+    DXFCPP_CONSTEXPR StringView() noexcept : data_{""}, size_{0} {}
+
+    /**
+     * Creates the view of the characters
+     *
+     * @param data The pointer to the first character
+     * @param size The number of the characters
+     */
+    DXFCPP_CONSTEXPR StringView(const char *data, std::size_t size) noexcept : data_{data}, size_{size} {}
+
+    /**
+     * Creates the view of the string literal (without the terminating zero)
+     *
+     * @tparam N The size of the literal
+     * @param literal The string literal
+     */
+    template <std::size_t N>
+    DXFCPP_CONSTEXPR StringView(const char (&literal)[N]) noexcept : data_{literal}, size_{N - 1} {}
+
+    ///
+    DXFCPP_CONSTEXPR const char *data() const noexcept { return data_; }
+
+    ///
+    DXFCPP_CONSTEXPR std::size_t size() const noexcept { return size_; }
+
+    ///
+    DXFCPP_CONSTEXPR bool empty() const noexcept { return size_ == 0; }
+
+    ///
+    DXFCPP_CONSTEXPR char operator[](std::size_t index) const noexcept { return data_[index]; }
+
+    ///
+    std::string toString() const { return {data_, size_}; }
+
+    ///
+    operator std::string() const { return toString(); }
+
+    friend bool operator==(const StringView &a, const StringView &b) noexcept {
+        return a.size_ == b.size_ && (a.size_ == 0 || std::memcmp(a.data_, b.data_, a.size_) == 0);
+    }
+
+    friend bool operator!=(const StringView &a, const StringView &b) noexcept { return !(a == b); }
+
+    friend bool operator==(const StringView &a, const std::string &b) noexcept {
+        return a == StringView(b.data(), b.size());
+    }
+
+    friend bool operator==(const std::string &a, const StringView &b) noexcept { return b == a; }
+
+    friend std::string operator+(std::string a, const StringView &b) { return a.append(b.data_, b.size_); }
+
+    friend std::string operator+(const StringView &a, const std::string &b) { return a.toString() + b; }
+
+    friend std::ostream &operator<<(std::ostream &os, const StringView &value) {
+        return os.write(value.data_, static_cast<std::streamsize>(value.size_));
+    }
+};
+
 namespace math {
 
 /**